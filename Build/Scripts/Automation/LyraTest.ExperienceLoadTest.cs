@@ -0,0 +1,110 @@
+// Copyright Epic Games, Inc.All Rights Reserved.
+
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+using EpicGame;
+using Gauntlet;
+
+namespace LyraTest
+{
+	public class LyraExperienceLoadTestConfig : LyraTestConfig
+	{
+		[AutoParam]
+		public string LoadMap = "/ShooterMaps/Maps/L_Expanse";
+
+		// Experience to prefetch and travel to after the first load, leave empty to only measure the first load
+		[AutoParam]
+		public string NextExperience = "";
+
+		[AutoParam]
+		public string NextMap = "";
+
+		// Travel to the next experience without prefetching it, the baseline for the prefetched load
+		[AutoParam]
+		public bool NoPrefetch = false;
+
+		// Fails the test if an experience takes longer than this to load, 0 disables the budget
+		[AutoParam]
+		public float MaxLoadSeconds = 0.0f;
+
+		public override void ApplyToConfig(UnrealAppConfig AppConfig, UnrealSessionRole ConfigRole, IEnumerable<UnrealSessionRole> OtherRoles)
+		{
+			base.ApplyToConfig(AppConfig, ConfigRole, OtherRoles);
+
+			if (AppConfig.ProcessType.IsServer())
+			{
+				AppConfig.CommandLine += string.Format(" -nullrhi -ExperienceLoadMaxSeconds={0}", MaxLoadSeconds);
+
+				if (!string.IsNullOrEmpty(NextExperience))
+				{
+					AppConfig.CommandLine += string.Format(" -NextExperience={0}", NextExperience);
+				}
+
+				if (!string.IsNullOrEmpty(NextMap))
+				{
+					AppConfig.CommandLine += string.Format(" -NextMap={0}", NextMap);
+				}
+
+				if (NoPrefetch)
+				{
+					AppConfig.CommandLine += " -NoPrefetch";
+				}
+			}
+		}
+	}
+
+	/// <summary>
+	/// Headless experience load test, measures how long a dedicated server takes to load an experience (and a prefetched next one)
+	/// </summary>
+	public class ExperienceLoadTest : EpicGameTestNode<LyraExperienceLoadTestConfig>
+	{
+		public ExperienceLoadTest(UnrealTestContext InContext) : base (InContext)
+		{
+		}
+
+		public override LyraExperienceLoadTestConfig GetConfiguration()
+		{
+			LyraExperienceLoadTestConfig Config = base.GetConfiguration();
+			Config.NoMCP = true;
+
+			UnrealTestRole Server = Config.RequireRole(UnrealTargetRole.Server);
+			Server.Controllers.Add("ExperienceLoad");
+			Server.MapOverride = Config.LoadMap;
+
+			return Config;
+		}
+	}
+
+	public class LyraExperienceLoadBaselineTestConfig : LyraExperienceLoadTestConfig
+	{
+		public LyraExperienceLoadBaselineTestConfig()
+		{
+			NoPrefetch = true;
+		}
+	}
+
+	/// <summary>
+	/// The experience load test without the next experience prefetch, run with the same NextExperience to compare against ExperienceLoadTest
+	/// </summary>
+	public class ExperienceLoadBaselineTest : EpicGameTestNode<LyraExperienceLoadBaselineTestConfig>
+	{
+		public ExperienceLoadBaselineTest(UnrealTestContext InContext) : base (InContext)
+		{
+		}
+
+		public override LyraExperienceLoadBaselineTestConfig GetConfiguration()
+		{
+			LyraExperienceLoadBaselineTestConfig Config = base.GetConfiguration();
+			Config.NoMCP = true;
+
+			UnrealTestRole Server = Config.RequireRole(UnrealTargetRole.Server);
+			Server.Controllers.Add("ExperienceLoad");
+			Server.MapOverride = Config.LoadMap;
+
+			return Config;
+		}
+	}
+}
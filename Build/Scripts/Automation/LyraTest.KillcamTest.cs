@@ -0,0 +1,66 @@
+// Copyright Epic Games, Inc.All Rights Reserved.
+
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+using EpicGame;
+using Gauntlet;
+
+namespace LyraTest
+{
+	public class LyraKillcamTestConfig : LyraTestConfig
+	{
+		[AutoParam]
+		public string KillcamMap = "/ShooterMaps/Maps/L_Expanse";
+
+		[AutoParam]
+		public int KillcamBots = 8;
+
+		[AutoParam]
+		public float KillcamRecordSeconds = 30.0f;
+
+		[AutoParam]
+		public int KillcamSeeks = 20;
+
+		// Budget overrides passed straight to the client, e.g. "-KillcamMaxSeekMs=100 -KillcamMaxPlaybackMemoryMB=512"
+		[AutoParam]
+		public string KillcamBudgets = "";
+
+		public override void ApplyToConfig(UnrealAppConfig AppConfig, UnrealSessionRole ConfigRole, IEnumerable<UnrealSessionRole> OtherRoles)
+		{
+			base.ApplyToConfig(AppConfig, ConfigRole, OtherRoles);
+
+			if (AppConfig.ProcessType.IsClient())
+			{
+				AppConfig.CommandLine += string.Format(" -nullrhi -KillcamBots={0} -KillcamRecordSeconds={1} -KillcamSeeks={2} {3}", KillcamBots, KillcamRecordSeconds, KillcamSeeks, KillcamBudgets);
+			}
+
+			const float InitTime = 180.0f;
+			MaxDuration = InitTime + KillcamRecordSeconds + (KillcamSeeks * 10.0f);
+		}
+	}
+
+	/// <summary>
+	/// Headless killcam test, records a bot match on a standalone client, plays the killcam back and measures seek latency and memory
+	/// </summary>
+	public class KillcamTest : EpicGameTestNode<LyraKillcamTestConfig>
+	{
+		public KillcamTest(UnrealTestContext InContext) : base (InContext)
+		{
+		}
+
+		public override LyraKillcamTestConfig GetConfiguration()
+		{
+			LyraKillcamTestConfig Config = base.GetConfiguration();
+			Config.NoMCP = true;
+
+			UnrealTestRole Client = Config.RequireRole(UnrealTargetRole.Client);
+			Client.Controllers.Add("Killcam");
+			Client.MapOverride = Config.KillcamMap;
+
+			return Config;
+		}
+	}
+}
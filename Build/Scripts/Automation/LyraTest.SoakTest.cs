@@ -0,0 +1,103 @@
+// Copyright Epic Games, Inc.All Rights Reserved.
+
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+using EpicGame;
+using Gauntlet;
+
+namespace LyraTest
+{
+	public class LyraSoakTestConfig : LyraTestConfig
+	{
+		[AutoParam]
+		public string SoakMap = "/ShooterMaps/Maps/L_Expanse";
+
+		[AutoParam]
+		public int SoakBots = 16;
+
+		[AutoParam]
+		public float SoakMinutes = 5.0f;
+
+		// Budget overrides passed straight to the server, e.g. "-SoakMaxFrameTimeP99Ms=40 -SoakMaxMemoryMB=4096"
+		[AutoParam]
+		public string SoakBudgets = "";
+
+		// Record a Networking Insights trace on the server, for per class and per property replication bytes
+		[AutoParam]
+		public bool SoakNetTrace = false;
+
+		public override void ApplyToConfig(UnrealAppConfig AppConfig, UnrealSessionRole ConfigRole, IEnumerable<UnrealSessionRole> OtherRoles)
+		{
+			base.ApplyToConfig(AppConfig, ConfigRole, OtherRoles);
+
+			if (AppConfig.ProcessType.IsServer())
+			{
+				AppConfig.CommandLine += string.Format(" -nullrhi -SoakBots={0} -SoakMinutes={1} {2}", SoakBots, SoakMinutes, SoakBudgets);
+
+				if (SoakNetTrace)
+				{
+					AppConfig.CommandLine += " -NetTrace=1 -trace=net";
+				}
+			}
+
+			const float InitTime = 180.0f;
+			MaxDuration = InitTime + (SoakMinutes * 60.0f);
+		}
+	}
+
+	/// <summary>
+	/// Headless soak test, runs a dedicated server with bots and fails if it goes over its performance budgets
+	/// </summary>
+	public class SoakTest : EpicGameTestNode<LyraSoakTestConfig>
+	{
+		public SoakTest(UnrealTestContext InContext) : base (InContext)
+		{
+		}
+
+		public override LyraSoakTestConfig GetConfiguration()
+		{
+			LyraSoakTestConfig Config = base.GetConfiguration();
+			Config.NoMCP = true;
+
+			UnrealTestRole Server = Config.RequireRole(UnrealTargetRole.Server);
+			Server.Controllers.Add("SoakTest");
+			Server.MapOverride = Config.SoakMap;
+
+			return Config;
+		}
+	}
+
+	public class LyraArenaSoakTestConfig : LyraSoakTestConfig
+	{
+		public LyraArenaSoakTestConfig()
+		{
+			SoakMap = "/TopDownArena/Maps/L_TopDownArenaGym";
+			SoakBots = 200;
+		}
+	}
+
+	/// <summary>
+	/// The soak test in the top down arena with a crowd of bots, used to benchmark arena movement and attribute replication
+	/// </summary>
+	public class TopDownArenaSoakTest : EpicGameTestNode<LyraArenaSoakTestConfig>
+	{
+		public TopDownArenaSoakTest(UnrealTestContext InContext) : base (InContext)
+		{
+		}
+
+		public override LyraArenaSoakTestConfig GetConfiguration()
+		{
+			LyraArenaSoakTestConfig Config = base.GetConfiguration();
+			Config.NoMCP = true;
+
+			UnrealTestRole Server = Config.RequireRole(UnrealTargetRole.Server);
+			Server.Controllers.Add("SoakTest");
+			Server.MapOverride = Config.SoakMap;
+
+			return Config;
+		}
+	}
+}
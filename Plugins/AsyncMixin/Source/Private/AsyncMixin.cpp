@@ -1,8 +1,10 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "AsyncMixin.h"
+#include "Async/Async.h"
 #include "Containers/Ticker.h"
 #include "Engine/AssetManager.h"
+#include "Misc/CoreDelegates.h"
 #include "Stats/Stats.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogAsyncMixin, Log, All);
@@ -145,6 +147,7 @@ void FAsyncMixin::FLoadingState::CancelOnly(bool bDestroying)
 	}
 
 	CancelStartTimer();
+	CancelFlushPendingLoads();
 
 	for (TUniquePtr<FAsyncStep>& Step : AsyncSteps)
 	{
@@ -219,6 +222,8 @@ void FAsyncMixin::FLoadingState::Start()
 		bHasStarted = true;
 		OwnerRef.OnStartedLoading();
 	}
+
+	FlushPendingLoads();
 	
 	TryCompleteAsyncLoading();
 }
@@ -227,13 +232,15 @@ void FAsyncMixin::FLoadingState::AsyncLoad(FSoftObjectPath SoftObjectPath, const
 {
 	UE_LOG(LogAsyncMixin, Verbose, TEXT("[0x%X] AsyncLoad '%s'"), this, *SoftObjectPath.ToString());
 
-	AsyncSteps.Add(
-		MakeUnique<FAsyncStep>(
-			DelegateToCall,
-			UAssetManager::GetStreamableManager().RequestAsyncLoad(SoftObjectPath, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority, false, false, TEXT("AsyncMixin"))
-			)
-	);
+	TArray<FSoftObjectPath> PathsToLoad;
+	if (!SoftObjectPath.IsNull())
+	{
+		PathsToLoad.Add(MoveTemp(SoftObjectPath));
+	}
+
+	AsyncSteps.Add(MakeUnique<FAsyncStep>(DelegateToCall, MoveTemp(PathsToLoad)));
 
+	ScheduleFlushPendingLoads();
 	TryScheduleStart();
 }
 
@@ -241,13 +248,19 @@ void FAsyncMixin::FLoadingState::AsyncLoad(const TArray<FSoftObjectPath>& SoftOb
 {
 	UE_LOG(LogAsyncMixin, Verbose, TEXT("[0x%X] AsyncLoad [%s]"), this, *FString::JoinBy(SoftObjectPaths, TEXT(", "), [](const FSoftObjectPath& SoftObjectPath) { return FString::Printf(TEXT("'%s'"), *SoftObjectPath.ToString()); }));
 
-	AsyncSteps.Add(
-		MakeUnique<FAsyncStep>(
-			DelegateToCall,
-			UAssetManager::GetStreamableManager().RequestAsyncLoad(SoftObjectPaths, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority, false, false, TEXT("AsyncMixin"))
-			)
-	);
+	TArray<FSoftObjectPath> PathsToLoad;
+	PathsToLoad.Reserve(SoftObjectPaths.Num());
+	for (const FSoftObjectPath& SoftObjectPath : SoftObjectPaths)
+	{
+		if (!SoftObjectPath.IsNull())
+		{
+			PathsToLoad.AddUnique(SoftObjectPath);
+		}
+	}
+
+	AsyncSteps.Add(MakeUnique<FAsyncStep>(DelegateToCall, MoveTemp(PathsToLoad)));
 
+	ScheduleFlushPendingLoads();
 	TryScheduleStart();
 }
 
@@ -307,6 +320,72 @@ void FAsyncMixin::FLoadingState::TryScheduleStart()
 	}
 }
 
+void FAsyncMixin::FLoadingState::ScheduleFlushPendingLoads()
+{
+	// Send the loads off before this frame is over, even if nobody starts the sequence until the start timer fires
+	// next frame, so the streamable manager can already be working on them.
+	if (!FlushPendingLoadsDelegate.IsValid())
+	{
+		FlushPendingLoadsDelegate = FCoreDelegates::OnEndFrame.AddSP(this, &FLoadingState::FlushPendingLoads);
+	}
+}
+
+void FAsyncMixin::FLoadingState::CancelFlushPendingLoads()
+{
+	if (FlushPendingLoadsDelegate.IsValid())
+	{
+		FCoreDelegates::OnEndFrame.Remove(FlushPendingLoadsDelegate);
+		FlushPendingLoadsDelegate.Reset();
+	}
+}
+
+void FAsyncMixin::FLoadingState::FlushPendingLoads()
+{
+	CancelFlushPendingLoads();
+
+	// Every load queued since the last flush is sent off as one streamable request, shared by all of the flushed steps.
+	TArray<FAsyncStep*, TInlineAllocator<8>> FlushedSteps;
+	TArray<FSoftObjectPath> PathsToLoad;
+	for (int32 StepIndex = CurrentAsyncStep; StepIndex < AsyncSteps.Num(); StepIndex++)
+	{
+		FAsyncStep* Step = AsyncSteps[StepIndex].Get();
+		if (Step->HasPendingLoad())
+		{
+			FlushedSteps.Add(Step);
+			for (const FSoftObjectPath& SoftObjectPath : Step->GetLoadPaths())
+			{
+				PathsToLoad.AddUnique(SoftObjectPath);
+			}
+		}
+	}
+
+	if (FlushedSteps.Num() == 0)
+	{
+		return;
+	}
+
+	UE_LOG(LogAsyncMixin, Verbose, TEXT("[0x%X] FlushPendingLoads - %d step(s), %d path(s)"), this, FlushedSteps.Num(), PathsToLoad.Num());
+
+	TSharedPtr<FStreamableHandle> StreamingHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(PathsToLoad), FStreamableDelegate::CreateSP(this, &FLoadingState::TryCompleteAsyncLoading), FStreamableManager::AsyncLoadHighPriority, false, false, TEXT("AsyncMixin"));
+
+	// The steps don't have to wait for the whole request, a step is done as soon as its own assets are in, so the waiting
+	// step is re-checked every time part of the request finishes loading.
+	if (StreamingHandle.IsValid() && StreamingHandle->IsLoadingInProgress())
+	{
+		StreamingHandle->BindUpdateDelegate(FStreamableUpdateDelegate::CreateSP(this, &FLoadingState::HandlePendingLoadsUpdated));
+	}
+
+	for (FAsyncStep* Step : FlushedSteps)
+	{
+		Step->SetStreamingHandle(StreamingHandle);
+	}
+}
+
+void FAsyncMixin::FLoadingState::HandlePendingLoadsUpdated(TSharedRef<FStreamableHandle> StreamingHandle)
+{
+	TryCompleteAsyncLoading();
+}
+
 bool FAsyncMixin::FLoadingState::IsLoadingInProgress() const
 {
 	if (AsyncSteps.Num() > 0)
@@ -352,6 +431,14 @@ void FAsyncMixin::FLoadingState::TryCompleteAsyncLoading()
 	while (CurrentAsyncStep < AsyncSteps.Num())
 	{
 		FAsyncStep* Step = AsyncSteps[CurrentAsyncStep].Get();
+
+		// A user callback may have queued more loads while we were already running, send them off now rather than
+		// waiting on the start timer.
+		if (Step->HasPendingLoad())
+		{
+			FlushPendingLoads();
+		}
+
 		if (Step->IsLoadingInProgress())
 		{
 			if (!Step->IsCompleteDelegateBound())
@@ -442,6 +529,12 @@ FAsyncMixin::FLoadingState::FAsyncStep::FAsyncStep(const FSimpleDelegate& InUser
 {
 }
 
+FAsyncMixin::FLoadingState::FAsyncStep::FAsyncStep(const FSimpleDelegate& InUserCallback, TArray<FSoftObjectPath>&& InLoadPaths)
+	: UserCallback(InUserCallback)
+	, LoadPaths(MoveTemp(InLoadPaths))
+{
+}
+
 FAsyncMixin::FLoadingState::FAsyncStep::~FAsyncStep()
 {
 
@@ -453,11 +546,37 @@ void FAsyncMixin::FLoadingState::FAsyncStep::ExecuteUserCallback()
 	UserCallback.Unbind();
 }
 
+void FAsyncMixin::FLoadingState::FAsyncStep::SetStreamingHandle(const TSharedPtr<FStreamableHandle>& InStreamingHandle)
+{
+	bLoadRequested = true;
+	StreamingHandle = InStreamingHandle;
+}
+
+bool FAsyncMixin::FLoadingState::FAsyncStep::AreLoadPathsLoaded() const
+{
+	for (const FSoftObjectPath& SoftObjectPath : LoadPaths)
+	{
+		const UObject* Object = SoftObjectPath.ResolveObject();
+		if (Object == nullptr || Object->HasAnyFlags(RF_NeedLoad) || Object->HasAnyInternalFlags(EInternalObjectFlags::AsyncLoading))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 bool FAsyncMixin::FLoadingState::FAsyncStep::IsComplete() const
 {
-	if (StreamingHandle.IsValid())
+	if (HasPendingLoad())
+	{
+		// Not even requested yet.
+		return false;
+	}
+	else if (StreamingHandle.IsValid())
 	{
-		return StreamingHandle->HasLoadCompleted();
+		// The request may be shared with later steps, so don't wait on all of it when our own part is already in.
+		return StreamingHandle->HasLoadCompleted() || ((LoadPaths.Num() > 0) && AreLoadPathsLoaded());
 	}
 	else if (Condition.IsValid())
 	{
@@ -469,9 +588,12 @@ bool FAsyncMixin::FLoadingState::FAsyncStep::IsComplete() const
 
 void FAsyncMixin::FLoadingState::FAsyncStep::Cancel()
 {
+	LoadPaths.Reset();
+
 	if (StreamingHandle.IsValid())
 	{
 		StreamingHandle->BindCompleteDelegate(FSimpleDelegate());
+		StreamingHandle->BindUpdateDelegate(FStreamableUpdateDelegate());
 		StreamingHandle.Reset();
 	}
 	else if (Condition.IsValid())
@@ -490,6 +612,12 @@ bool FAsyncMixin::FLoadingState::FAsyncStep::BindCompleteDelegate(const FSimpleD
 		return false;
 	}
 
+	if (!ensure(!HasPendingLoad()))
+	{
+		// Pending loads need to be flushed before anyone can listen for them.
+		return false;
+	}
+
 	if (StreamingHandle.IsValid())
 	{
 		StreamingHandle->BindCompleteDelegate(NewDelegate);
@@ -527,6 +655,38 @@ FAsyncCondition::~FAsyncCondition()
 	FTSTicker::GetCoreTicker().RemoveTicker(RepeatHandle);
 }
 
+void FAsyncCondition::Signal()
+{
+	if (!IsInGameThread())
+	{
+		AsyncTask(ENamedThreads::GameThread, [WeakThis = TWeakPtr<FAsyncCondition>(AsShared())]() {
+			if (TSharedPtr<FAsyncCondition> StrongThis = WeakThis.Pin())
+			{
+				StrongThis->Signal();
+			}
+		});
+		return;
+	}
+
+	// Nobody is waiting on us yet (or we already completed), the next BindCompleteDelegate will evaluate the condition.
+	if (!RepeatHandle.IsValid())
+	{
+		return;
+	}
+
+	UE_LOG(LogAsyncMixin, Verbose, TEXT("[0x%X] AsyncCondition::Signal"), this);
+
+	// Completing may release the last reference the async sequence has on us.
+	TSharedRef<FAsyncCondition> KeepAlive = AsShared();
+
+	const FTSTicker::FDelegateHandle PollHandle = RepeatHandle;
+	if (!TryToContinue(0.0f))
+	{
+		// Completed outside of the ticker, so stop polling.
+		FTSTicker::GetCoreTicker().RemoveTicker(PollHandle);
+	}
+}
+
 bool FAsyncCondition::IsComplete() const
 {
 	if (UserCondition.IsBound())
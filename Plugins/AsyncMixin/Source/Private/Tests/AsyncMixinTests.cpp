@@ -0,0 +1,115 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AsyncMixin.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAsyncMixinChainedLoadLatencyTest, "AsyncMixin.ChainedLoadLatency", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAsyncMixinChainedLoadLatencyTest::RunTest(const FString& Parameters)
+{
+	// Loaded by the engine at startup, so requesting them never has to wait on the loader
+	const FSoftObjectPath FirstResidentAssetPath(TEXT("/Engine/EngineMaterials/DefaultMaterial.DefaultMaterial"));
+	const FSoftObjectPath SecondResidentAssetPath(TEXT("/Engine/EngineMaterials/WorldGridMaterial.WorldGridMaterial"));
+
+	// Usually not resident, so its request has to go through the loader
+	const FSoftObjectPath StreamedAssetPath(TEXT("/Engine/BasicShapes/Cone.Cone"));
+
+	const double TimeoutSeconds = 30.0;
+
+	struct FChainedLoad
+	{
+		FAsyncScope Scope;
+
+		uint64 StartFrame = 0;
+		double StartTime = 0.0;
+
+		TArray<uint64> StepFrames;
+		bool bFinished = false;
+	};
+
+	// The first step only needs a resident asset and must not wait on the streamed one queued behind it.  The streamed
+	// step then chains another load from its callback, the way a widget loads an asset and then what that asset points
+	// at, and that link must not cost a frame.
+	TSharedRef<FChainedLoad> Chain = MakeShared<FChainedLoad>();
+	FChainedLoad* ChainPtr = &Chain.Get();
+
+	Chain->StartFrame = GFrameCounter;
+	Chain->StartTime = FPlatformTime::Seconds();
+
+	Chain->Scope.AsyncLoad(FirstResidentAssetPath, FSimpleDelegate::CreateLambda([ChainPtr]() {
+		ChainPtr->StepFrames.Add(GFrameCounter);
+	}));
+
+	Chain->Scope.AsyncLoad(StreamedAssetPath, FSimpleDelegate::CreateLambda([ChainPtr, SecondResidentAssetPath]() {
+		ChainPtr->StepFrames.Add(GFrameCounter);
+
+		ChainPtr->Scope.AsyncLoad(SecondResidentAssetPath, FSimpleDelegate::CreateLambda([ChainPtr]() {
+			ChainPtr->StepFrames.Add(GFrameCounter);
+			ChainPtr->bFinished = true;
+		}));
+		ChainPtr->Scope.StartAsyncLoading();
+	}));
+
+	Chain->Scope.StartAsyncLoading();
+
+	if (TestTrue(TEXT("The first step completes when the sequence starts"), Chain->StepFrames.Num() >= 1))
+	{
+		TestTrue(TEXT("The first step completes in the start frame"), Chain->StepFrames[0] == Chain->StartFrame);
+	}
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Chain, TimeoutSeconds]() {
+		if (!Chain->bFinished)
+		{
+			if ((FPlatformTime::Seconds() - Chain->StartTime) < TimeoutSeconds)
+			{
+				return false;
+			}
+
+			AddError(FString::Printf(TEXT("The streamed step did not complete within %.0fs"), TimeoutSeconds));
+			Chain->Scope.CancelAsyncLoading();
+			return true;
+		}
+
+		if (TestEqual(TEXT("Every step completed once"), Chain->StepFrames.Num(), 3))
+		{
+			TestTrue(TEXT("The chained load completes in the frame of the step that queued it"), Chain->StepFrames[2] == Chain->StepFrames[1]);
+		}
+		return true;
+	}));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAsyncMixinConditionSignalTest, "AsyncMixin.ConditionSignal", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAsyncMixinConditionSignalTest::RunTest(const FString& Parameters)
+{
+	bool bConditionMet = false;
+	bool bStepCompleted = false;
+
+	TSharedRef<FAsyncCondition> Condition = MakeShared<FAsyncCondition>([&bConditionMet]() {
+		return bConditionMet ? EAsyncConditionResult::Complete : EAsyncConditionResult::TryAgain;
+	});
+
+	FAsyncScope Scope;
+	Scope.AsyncCondition(Condition, FSimpleDelegate::CreateLambda([&bStepCompleted]() {
+		bStepCompleted = true;
+	}));
+	Scope.StartAsyncLoading();
+
+	TestFalse(TEXT("The step waits on its condition"), bStepCompleted);
+
+	Condition->Signal();
+	TestFalse(TEXT("Signalling a condition that is still unmet does not continue"), bStepCompleted);
+
+	bConditionMet = true;
+	Condition->Signal();
+	TestTrue(TEXT("Signalling a met condition continues the sequence right away, without waiting on the poll"), bStepCompleted);
+	TestFalse(TEXT("The sequence is done"), Scope.IsAsyncLoadingInProgress());
+
+	return true;
+}
+
+#endif
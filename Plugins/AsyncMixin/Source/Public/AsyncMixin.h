@@ -51,7 +51,11 @@ DECLARE_DELEGATE_OneParam(FStreamableHandleDelegate, TSharedPtr<FStreamableHandl
  * requested the async loads - even if ItemOne or ItemTwo was already loaded when you request it.
  *
  * When all the async loading requests complete, OnFinishedLoading will be called.
- * 
+ *
+ * The loads are not sent to the streamable manager one at a time as you add them, all of the loads queued up during a
+ * frame are issued as a single streamable request at the end of that frame (or as soon as the sequence starts, if that
+ * comes first).  A callback still only waits on its own assets and the ones before it, not the whole request.
+ *
  * If you forget to call StartAsyncLoading(), we'll call it next frame, but you should remember to call it
  * when you're done with your setup, as maybe everything is already loaded, and it will avoid a single frame
  * of a loading indicator flash, which is annoying.
@@ -226,6 +230,10 @@ private:
 		void CancelOnly(bool bDestroying);
 		void CancelStartTimer();
 		void TryScheduleStart();
+		void ScheduleFlushPendingLoads();
+		void CancelFlushPendingLoads();
+		void FlushPendingLoads();
+		void HandlePendingLoadsUpdated(TSharedRef<FStreamableHandle> StreamingHandle);
 		void TryCompleteAsyncLoading();
 		void CompleteAsyncLoading();
 
@@ -248,6 +256,7 @@ private:
 			FAsyncStep(const FSimpleDelegate& InUserCallback);
 			FAsyncStep(const FSimpleDelegate& InUserCallback, const TSharedPtr<FStreamableHandle>& InStreamingHandle);
 			FAsyncStep(const FSimpleDelegate& InUserCallback, const TSharedPtr<FAsyncCondition>& InCondition);
+			FAsyncStep(const FSimpleDelegate& InUserCallback, TArray<FSoftObjectPath>&& InLoadPaths);
 
 			~FAsyncStep();
 
@@ -264,6 +273,15 @@ private:
 			bool BindCompleteDelegate(const FSimpleDelegate& NewDelegate);
 			bool IsCompleteDelegateBound() const;
 
+			/** Does this step have paths to load that have not been handed to the streamable manager yet? */
+			bool HasPendingLoad() const { return (LoadPaths.Num() > 0) && !bLoadRequested; }
+			const TArray<FSoftObjectPath>& GetLoadPaths() const { return LoadPaths; }
+			void SetStreamingHandle(const TSharedPtr<FStreamableHandle>& InStreamingHandle);
+
+		private:
+			/** Are all of LoadPaths in memory?  The request they are part of may still be loading the paths of later steps. */
+			bool AreLoadPathsLoaded() const;
+
 		private:
 			FSimpleDelegate UserCallback;
 			bool bIsCompletionDelegateBound = false;
@@ -271,6 +289,10 @@ private:
 			// Possible Async 'thing'
 			TSharedPtr<FStreamableHandle> StreamingHandle;
 			TSharedPtr<FAsyncCondition> Condition;
+
+			// Loads are queued up and issued in one request with any other loads pending at the end of the frame.
+			TArray<FSoftObjectPath> LoadPaths;
+			bool bLoadRequested = false;
 		};
 
 		bool bHasStarted = false;
@@ -281,6 +303,7 @@ private:
 
 		FTSTicker::FDelegateHandle StartTimerDelegate;
 		FTSTicker::FDelegateHandle DestroyMemoryDelegate;
+		FDelegateHandle FlushPendingLoadsDelegate;
 	};
 
 	const FLoadingState& GetLoadingStateConst() const;
@@ -333,6 +356,10 @@ DECLARE_DELEGATE_RetVal(EAsyncConditionResult, FAsyncConditionDelegate);
 
 /**
  * The async condition allows you to have custom reasons to hault the async loading until some condition is met.
+ *
+ * The condition is polled as a fallback, but whoever knows the condition may have changed (a delegate, a promise
+ * continuation, etc...) should call Signal() so the waiting async sequence continues immediately rather than on the
+ * next poll.
  */
 class FAsyncCondition : public TSharedFromThis<FAsyncCondition>
 {
@@ -341,6 +368,12 @@ public:
 	FAsyncCondition(TFunction<EAsyncConditionResult()>&& Condition);
 	virtual ~FAsyncCondition();
 
+	/**
+	 * Re-evaluates the condition right away, continuing the async sequence waiting on it if it is now complete.
+	 * Safe to call from any thread, off the game thread the evaluation is deferred to the game thread.
+	 */
+	void Signal();
+
 protected:
 	bool IsComplete() const;
 	bool BindCompleteDelegate(const FSimpleDelegate& NewDelegate);
@@ -42,6 +42,11 @@ public:
  	UPROPERTY(config, EditAnywhere, Category=Configuration, meta=(ForceUnits=s))
 	float LoadingScreenHeartbeatHangDuration = 0.0f;
 
+	// The interval in seconds between checks for a need to show the loading screen while it is hidden (if zero, checks every frame).
+	// Processors that report their changes through ILoadingProcessInterface::NotifyLoadingStateChanged are picked up on the next frame.
+ 	UPROPERTY(config, EditAnywhere, Category=Configuration, meta=(ForceUnits=s, ConsoleVariable="CommonLoadingScreen.UpdateHeartbeatInterval"))
+	float UpdateHeartbeatInterval = 0.5f;
+
 	// The interval in seconds between each log of what is keeping a loading screen up (if non-zero).
  	UPROPERTY(config, EditAnywhere, Category=Configuration, meta=(ForceUnits=s))
 	float LogLoadingScreenHeartbeatInterval = 5.0f;
@@ -62,6 +62,16 @@ bool ILoadingProcessInterface::ShouldShowLoadingScreen(UObject* TestObject, FStr
 	return false;
 }
 
+void ILoadingProcessInterface::NotifyLoadingStateChanged(UObject* Processor)
+{
+	UWorld* World = Processor ? Processor->GetWorld() : nullptr;
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	if (ULoadingScreenManager* LoadingScreenManager = GameInstance ? GameInstance->GetSubsystem<ULoadingScreenManager>() : nullptr)
+	{
+		LoadingScreenManager->NotifyLoadingStateChanged();
+	}
+}
+
 //////////////////////////////////////////////////////////////////////
 
 namespace LoadingScreenCVars
@@ -87,6 +97,13 @@ namespace LoadingScreenCVars
 		ForceLoadingScreenVisible,
 		TEXT("Force the loading screen to show."),
 		ECVF_Default);
+
+	static float UpdateHeartbeatInterval = 0.5f;
+	static FAutoConsoleVariableRef CVarUpdateHeartbeatInterval(
+		TEXT("CommonLoadingScreen.UpdateHeartbeatInterval"),
+		UpdateHeartbeatInterval,
+		TEXT("The interval in seconds between checks for a need to show the loading screen while it is hidden (0 checks every frame)"),
+		ECVF_Default);
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -152,6 +169,9 @@ bool ULoadingScreenManager::ShouldCreateSubsystem(UObject* Outer) const
 
 void ULoadingScreenManager::Tick(float DeltaTime)
 {
+	bLoadingStateDirty = false;
+	NextUpdateHeartbeatTime = FPlatformTime::Seconds() + LoadingScreenCVars::UpdateHeartbeatInterval;
+
 	UpdateLoadingScreen();
 
 	TimeUntilNextLogHeartbeatSeconds = FMath::Max(TimeUntilNextLogHeartbeatSeconds - DeltaTime, 0.0);
@@ -164,7 +184,18 @@ ETickableTickType ULoadingScreenManager::GetTickableTickType() const
 
 bool ULoadingScreenManager::IsTickable() const
 {
-	return !HasAnyFlags(RF_ClassDefaultObject);
+	return !HasAnyFlags(RF_ClassDefaultObject) && NeedsUpdate();
+}
+
+bool ULoadingScreenManager::NeedsUpdate() const
+{
+	// While the loading screen is up (including the hold time) the conditions that can take it down are checked every frame,
+	// once it is hidden only reported state changes, map loads and a low-frequency heartbeat can bring it back
+	return bCurrentlyShowingLoadingScreen
+		|| bLoadingStateDirty
+		|| bCurrentlyInLoadMap
+		|| LoadingScreenCVars::LogLoadingScreenReasonEveryFrame
+		|| (FPlatformTime::Seconds() >= NextUpdateHeartbeatTime);
 }
 
 TStatId ULoadingScreenManager::GetStatId() const
@@ -180,11 +211,18 @@ UWorld* ULoadingScreenManager::GetTickableGameObjectWorld() const
 void ULoadingScreenManager::RegisterLoadingProcessor(TScriptInterface<ILoadingProcessInterface> Interface)
 {
 	ExternalLoadingProcessors.Add(Interface.GetObject());
+	NotifyLoadingStateChanged();
 }
 
 void ULoadingScreenManager::UnregisterLoadingProcessor(TScriptInterface<ILoadingProcessInterface> Interface)
 {
 	ExternalLoadingProcessors.Remove(Interface.GetObject());
+	NotifyLoadingStateChanged();
+}
+
+void ULoadingScreenManager::NotifyLoadingStateChanged()
+{
+	bLoadingStateDirty = true;
 }
 
 void ULoadingScreenManager::HandlePreLoadMap(const FWorldContext& WorldContext, const FString& MapName)
@@ -206,6 +244,7 @@ void ULoadingScreenManager::HandlePostLoadMap(UWorld* World)
 	if ((World != nullptr) && (World->GetGameInstance() == GetGameInstance()))
 	{
 		bCurrentlyInLoadMap = false;
+		bLoadingStateDirty = true;
 	}
 }
 
@@ -0,0 +1,85 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LoadingScreenManager.h"
+#include "Engine/GameInstance.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLoadingScreenManagerTickGatingTest, "CommonLoadingScreen.Manager.TickGating", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLoadingScreenManagerTickGatingTest::RunTest(const FString& Parameters)
+{
+	// Not initialized, so it isn't bound to map loads and never touches a viewport.  The test only drives the state that
+	// Tick and the event handlers would set, and asks the tickable whether it wants to be ticked.
+	UGameInstance* GameInstance = NewObject<UGameInstance>(GetTransientPackage());
+	ULoadingScreenManager* Manager = NewObject<ULoadingScreenManager>(GameInstance);
+
+	IConsoleVariable* HeartbeatIntervalCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("CommonLoadingScreen.UpdateHeartbeatInterval"));
+	if (!TestNotNull(TEXT("CommonLoadingScreen.UpdateHeartbeatInterval exists"), HeartbeatIntervalCVar))
+	{
+		return false;
+	}
+	const float HeartbeatInterval = HeartbeatIntervalCVar->GetFloat();
+
+	// What Tick leaves behind once the loading screen has been hidden
+	auto SimulateHiddenTick = [Manager](double Interval)
+	{
+		Manager->bLoadingStateDirty = false;
+		Manager->bCurrentlyShowingLoadingScreen = false;
+		Manager->NextUpdateHeartbeatTime = FPlatformTime::Seconds() + Interval;
+	};
+
+	TestTrue(TEXT("A new manager evaluates the loading screen on its first frame"), Manager->IsTickable());
+
+	// Hidden and idle, nothing should tick until the heartbeat, so give it one far in the future
+	{
+		SimulateHiddenTick(3600.0);
+
+		int32 NumTickableFrames = 0;
+		for (int32 Frame = 0; Frame < 10000; Frame++)
+		{
+			NumTickableFrames += Manager->IsTickable() ? 1 : 0;
+		}
+
+		TestEqual(TEXT("A hidden loading screen with no state changes is never ticked"), NumTickableFrames, 0);
+	}
+
+	// Each trigger brings it back for exactly one evaluation
+	{
+		SimulateHiddenTick(3600.0);
+		Manager->NotifyLoadingStateChanged();
+		TestTrue(TEXT("A reported state change is evaluated on the next frame"), Manager->IsTickable());
+		SimulateHiddenTick(3600.0);
+		TestFalse(TEXT("The state change is only evaluated once"), Manager->IsTickable());
+
+		Manager->bCurrentlyInLoadMap = true;
+		TestTrue(TEXT("Loading a map is evaluated every frame"), Manager->IsTickable());
+		Manager->bCurrentlyInLoadMap = false;
+
+		Manager->bCurrentlyShowingLoadingScreen = true;
+		TestTrue(TEXT("A shown loading screen is evaluated every frame"), Manager->IsTickable());
+		Manager->bCurrentlyShowingLoadingScreen = false;
+
+		SimulateHiddenTick(-1.0);
+		TestTrue(TEXT("The heartbeat evaluates a hidden loading screen once it elapses"), Manager->IsTickable());
+
+		SimulateHiddenTick(HeartbeatInterval);
+		TestTrue(TEXT("The default heartbeat doesn't poll every frame"), Manager->IsTickable() == (HeartbeatInterval <= 0.0f));
+	}
+
+	{
+		HeartbeatIntervalCVar->Set(0.0f, ECVF_SetByCode);
+		SimulateHiddenTick(HeartbeatIntervalCVar->GetFloat());
+		TestTrue(TEXT("A zero heartbeat interval polls every frame"), Manager->IsTickable());
+		HeartbeatIntervalCVar->Set(HeartbeatInterval, ECVF_SetByCode);
+	}
+
+	// Leave it idle so nothing ticks it before it is collected
+	SimulateHiddenTick(TNumericLimits<double>::Max());
+
+	return true;
+}
+
+#endif
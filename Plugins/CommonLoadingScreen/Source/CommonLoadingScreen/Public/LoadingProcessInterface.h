@@ -23,6 +23,10 @@ public:
 	// be currently showing a loading screen
 	static bool ShouldShowLoadingScreen(UObject* TestObject, FString& OutReason);
 
+	// Processors must call this when their answer to ShouldShowLoadingScreen changes, the loading
+	// screen manager only polls them at a low frequency while the loading screen is hidden
+	static void NotifyLoadingStateChanged(UObject* Processor);
+
 	virtual bool ShouldShowLoadingScreen(FString& OutReason) const
 	{
 		return false;
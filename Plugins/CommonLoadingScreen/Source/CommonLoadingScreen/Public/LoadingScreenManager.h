@@ -54,12 +54,18 @@ public:
 
 	void RegisterLoadingProcessor(TScriptInterface<ILoadingProcessInterface> Interface);
 	void UnregisterLoadingProcessor(TScriptInterface<ILoadingProcessInterface> Interface);
+
+	/** Re-evaluates whether the loading screen is needed on the next tick (see ILoadingProcessInterface::NotifyLoadingStateChanged) */
+	void NotifyLoadingStateChanged();
 	
 private:
 	void HandlePreLoadMap(const FWorldContext& WorldContext, const FString& MapName);
 	void HandlePostLoadMap(UWorld* World);
 
-	/** Determines if we should show or hide the loading screen. Called every frame. */
+	/** Returns true if the loading screen needs to be re-evaluated this frame */
+	bool NeedsUpdate() const;
+
+	/** Determines if we should show or hide the loading screen. Called every frame while it is shown, and on state changes otherwise. */
 	void UpdateLoadingScreen();
 
 	/** Returns true if we need to be showing the loading screen. */
@@ -113,9 +119,19 @@ private:
 	/** The time until the next log for why the loading screen is still up */
 	double TimeUntilNextLogHeartbeatSeconds = 0.0;
 
+	/** The time of the next low-frequency re-evaluation while the loading screen is hidden */
+	double NextUpdateHeartbeatTime = 0.0;
+
+	/** True when something reported a state change that may require the loading screen */
+	bool bLoadingStateDirty = true;
+
 	/** True when we are between PreLoadMap and PostLoadMap */
 	bool bCurrentlyInLoadMap = false;
 
 	/** True when the loading screen is currently being shown */
 	bool bCurrentlyShowingLoadingScreen = false;
+
+#if WITH_DEV_AUTOMATION_TESTS
+	friend class FLoadingScreenManagerTickGatingTest;
+#endif
 };
@@ -231,6 +231,58 @@ public:
 
 #endif // COMMONUSER_OSSV1
 
+//////////////////////////////////////////////////////////////////////
+// FCommonSession_QuickPlayCandidate
+
+namespace CommonSessionQuickPlay
+{
+	// Prefer sessions that already have players in them, up to this much for an almost full session
+	static const float PopulationScore = 100.0f;
+
+	// Each ms of ping costs this much, so 100 ms of ping is worth the same as going from an empty to a full session
+	static const float PingScorePerMs = 1.0f;
+}
+
+float FCommonSession_QuickPlayCandidate::GetScore() const
+{
+	// The search already filters on the requested experience (SETTING_GAMEMODE), so only population and ping are scored
+	float Score = 0.0f;
+
+	if (MaxPublicConnections > 0)
+	{
+		const int32 NumFilledConnections = FMath::Clamp(MaxPublicConnections - NumOpenPublicConnections, 0, MaxPublicConnections);
+		Score += CommonSessionQuickPlay::PopulationScore * ((float)NumFilledConnections / (float)MaxPublicConnections);
+	}
+
+	const int32 ScoredPingInMs = (PingInMs >= UnknownPingInMs) ? UnknownPingScoredAsMs : FMath::Max(PingInMs, 0);
+	Score -= CommonSessionQuickPlay::PingScorePerMs * ScoredPingInMs;
+
+	return Score;
+}
+
+int32 FCommonSession_QuickPlayCandidate::PickBest(TArrayView<const FCommonSession_QuickPlayCandidate> Candidates)
+{
+	int32 BestIndex = INDEX_NONE;
+	float BestScore = 0.0f;
+
+	for (int32 Index = 0; Index < Candidates.Num(); ++Index)
+	{
+		if (!Candidates[Index].CanJoin())
+		{
+			continue;
+		}
+
+		const float Score = Candidates[Index].GetScore();
+		if ((BestIndex == INDEX_NONE) || (Score > BestScore))
+		{
+			BestIndex = Index;
+			BestScore = Score;
+		}
+	}
+
+	return BestIndex;
+}
+
 //////////////////////////////////////////////////////////////////////
 // UCommonSession_HostSessionRequest
 
@@ -743,7 +795,7 @@ void UCommonSessionSubsystem::FindSessionsInternalOSSv2(ULocalPlayer* LocalPlaye
 				}
 				else
 				{
-					UCommonSession_SearchResult* Entry = NewObject<UCommonSession_SearchResult>(SearchSettings->SearchRequest);
+					UCommonSession_SearchResult* Entry = AcquireSearchResult();
 					Entry->Lobby = Lobby;
 					SearchSettings->SearchRequest->Results.Add(Entry);
 
@@ -775,6 +827,20 @@ void UCommonSessionSubsystem::QuickPlaySession(APlayerController* JoiningOrHosti
 		return;
 	}
 
+	// Quick play is often retried straight away (e.g., after a failed join), reuse a recent search for the same thing
+	// rather than going back to the online service
+	const FString QuickPlayKey = GetQuickPlayCacheKey(HostRequest);
+	if ((CachedQuickPlayResults.Num() > 0) && (CachedQuickPlayKey == QuickPlayKey) && (FPlatformTime::Seconds() - CachedQuickPlayTime < QuickPlayResultCacheSeconds))
+	{
+		UE_LOG(LogCommonSession, Log, TEXT("QuickPlay using %d cached search result(s)"), CachedQuickPlayResults.Num());
+
+		const TArray<UCommonSession_SearchResult*> Results(CachedQuickPlayResults);
+		JoinBestQuickPlayResultOrHost(JoiningOrHostingPlayer, HostRequest, Results);
+		return;
+	}
+
+	ReleaseQuickPlayResultCache();
+
 	TStrongObjectPtr<UCommonSession_HostSessionRequest> HostRequestPtr = TStrongObjectPtr<UCommonSession_HostSessionRequest>(HostRequest);
 	TWeakObjectPtr<APlayerController> JoiningOrHostingPlayerPtr = TWeakObjectPtr<APlayerController>(JoiningOrHostingPlayer);
 
@@ -844,20 +910,15 @@ void UCommonSessionSubsystem::HandleQuickPlaySearchFinished(bool bSucceeded, con
 	//@TODO: We have to check if the error message is empty because some OSS layers report a failure just because there are no sessions.  Please fix with OSS 2.0.
 	if (bSucceeded || ErrorMessage.IsEmpty())
 	{
-		// Join the best search result.
-		if (ResultCount > 0)
-		{
-			//@TODO: We should probably look at ping?  maybe some other factors to find the best.  Idk if they come pre-sorted or not.
-			for (UCommonSession_SearchResult* Result : SearchSettings->SearchRequest->Results)
-			{
-				JoinSession(JoiningOrHostingPlayer.Get(), Result);
-				return;
-			}
-		}
-		else
-		{
-			HostSession(JoiningOrHostingPlayer.Get(), HostRequest.Get());
-		}
+		const TArray<UCommonSession_SearchResult*>& Results = SearchSettings->SearchRequest->Results;
+
+		// Remember the results in case quick play gets retried shortly
+		ReleaseQuickPlayResultCache();
+		CachedQuickPlayResults.Append(Results);
+		CachedQuickPlayKey = GetQuickPlayCacheKey(HostRequest.Get());
+		CachedQuickPlayTime = FPlatformTime::Seconds();
+
+		JoinBestQuickPlayResultOrHost(JoiningOrHostingPlayer.Get(), HostRequest.Get(), Results);
 	}
 	else
 	{
@@ -865,6 +926,77 @@ void UCommonSessionSubsystem::HandleQuickPlaySearchFinished(bool bSucceeded, con
 	}
 }
 
+FCommonSession_QuickPlayCandidate UCommonSessionSubsystem::MakeQuickPlayCandidate(const UCommonSession_SearchResult* Result, const UCommonSession_HostSessionRequest* HostRequest) const
+{
+	FCommonSession_QuickPlayCandidate Candidate;
+	Candidate.PingInMs = Result->GetPingInMs();
+	Candidate.NumOpenPublicConnections = Result->GetNumOpenPublicConnections();
+	Candidate.MaxPublicConnections = Result->GetMaxPublicConnections();
+
+	return Candidate;
+}
+
+void UCommonSessionSubsystem::JoinBestQuickPlayResultOrHost(APlayerController* JoiningOrHostingPlayer, UCommonSession_HostSessionRequest* HostRequest, const TArray<UCommonSession_SearchResult*>& Results)
+{
+	TArray<FCommonSession_QuickPlayCandidate, TInlineAllocator<16>> Candidates;
+	Candidates.Reserve(Results.Num());
+	for (const UCommonSession_SearchResult* Result : Results)
+	{
+		Candidates.Add(MakeQuickPlayCandidate(Result, HostRequest));
+	}
+
+	const int32 BestIndex = FCommonSession_QuickPlayCandidate::PickBest(Candidates);
+	if (BestIndex != INDEX_NONE)
+	{
+		UCommonSession_SearchResult* BestResult = Results[BestIndex];
+		UE_LOG(LogCommonSession, Log, TEXT("QuickPlay joining %s (score %.1f, %d of %d candidates)"), *BestResult->GetDescription(), Candidates[BestIndex].GetScore(), BestIndex + 1, Candidates.Num());
+
+		// Don't offer the same session again if this join fails and quick play gets retried
+		CachedQuickPlayResults.Remove(BestResult);
+
+		JoinSession(JoiningOrHostingPlayer, BestResult);
+	}
+	else
+	{
+		HostSession(JoiningOrHostingPlayer, HostRequest);
+	}
+}
+
+UCommonSession_SearchResult* UCommonSessionSubsystem::AcquireSearchResult()
+{
+	if (SearchResultPool.Num() > 0)
+	{
+		return SearchResultPool.Pop(/*bAllowShrinking=*/ false);
+	}
+
+	return NewObject<UCommonSession_SearchResult>(this);
+}
+
+void UCommonSessionSubsystem::ReleaseQuickPlayResultCache()
+{
+	// Quick play results are never handed out beyond the subsystem, so they can safely be reused
+	for (UCommonSession_SearchResult* Result : CachedQuickPlayResults)
+	{
+		if (Result != nullptr)
+		{
+#if COMMONUSER_OSSV1
+			Result->Result = FOnlineSessionSearchResult();
+#else
+			Result->Lobby.Reset();
+#endif // COMMONUSER_OSSV1
+			SearchResultPool.Add(Result);
+		}
+	}
+
+	CachedQuickPlayResults.Reset();
+	CachedQuickPlayKey.Reset();
+}
+
+FString UCommonSessionSubsystem::GetQuickPlayCacheKey(const UCommonSession_HostSessionRequest* HostRequest)
+{
+	return FString::Printf(TEXT("%d|%d|%s|%s"), (int32)HostRequest->OnlineMode, HostRequest->bUseLobbies ? 1 : 0, *HostRequest->ModeNameForAdvertisement, *HostRequest->MapID.ToString());
+}
+
 void UCommonSessionSubsystem::CleanUpSessions()
 {
 	bWantToDestroyPendingSession = true;
@@ -958,7 +1090,7 @@ void UCommonSessionSubsystem::OnFindSessionsComplete(bool bWasSuccessful)
 
 		for (const FOnlineSessionSearchResult& Result : SearchSettingsV1.SearchResults)
 		{
-			UCommonSession_SearchResult* Entry = NewObject<UCommonSession_SearchResult>(SearchSettingsV1.SearchRequest);
+			UCommonSession_SearchResult* Entry = AcquireSearchResult();
 			Entry->Result = Result;
 			SearchSettingsV1.SearchRequest->Results.Add(Entry);
 			FString OwningUserId = TEXT("Unknown");
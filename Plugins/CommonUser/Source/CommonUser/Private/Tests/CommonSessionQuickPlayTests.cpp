@@ -0,0 +1,72 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CommonSessionSubsystem.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCommonSessionQuickPlayPickBestTest, "CommonUser.Session.QuickPlay.PickBest", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FCommonSessionQuickPlayPickBestTest::RunTest(const FString& Parameters)
+{
+	using FCandidate = FCommonSession_QuickPlayCandidate;
+
+	auto MakeCandidate = [](int32 PingInMs, int32 NumOpen, int32 MaxConnections)
+	{
+		FCandidate Candidate;
+		Candidate.PingInMs = PingInMs;
+		Candidate.NumOpenPublicConnections = NumOpen;
+		Candidate.MaxPublicConnections = MaxConnections;
+		return Candidate;
+	};
+
+	{
+		TArray<FCandidate> Candidates;
+		TestEqual(TEXT("No candidates"), FCandidate::PickBest(Candidates), INDEX_NONE);
+	}
+
+	{
+		const TArray<FCandidate> Candidates = { MakeCandidate(20, 0, 8), MakeCandidate(20, 0, 16) };
+		TestEqual(TEXT("Full sessions can't be joined"), FCandidate::PickBest(Candidates), INDEX_NONE);
+	}
+
+	{
+		const TArray<FCandidate> Candidates = { MakeCandidate(10, 0, 8), MakeCandidate(400, 4, 8) };
+		TestEqual(TEXT("A joinable session wins over a full one, however bad its ping"), FCandidate::PickBest(Candidates), 1);
+	}
+
+	{
+		const TArray<FCandidate> Candidates = { MakeCandidate(80, 4, 8), MakeCandidate(30, 4, 8) };
+		TestEqual(TEXT("Lower ping wins"), FCandidate::PickBest(Candidates), 1);
+	}
+
+	{
+		const TArray<FCandidate> Candidates = { MakeCandidate(300, 4, 8), MakeCandidate(150, 4, 8) };
+		TestEqual(TEXT("Lower ping wins when both pings outweigh the population"), FCandidate::PickBest(Candidates), 1);
+	}
+
+	{
+		const TArray<FCandidate> Candidates = { MakeCandidate(40, 7, 8), MakeCandidate(40, 1, 8) };
+		TestEqual(TEXT("Fuller session wins"), FCandidate::PickBest(Candidates), 1);
+	}
+
+	{
+		const TArray<FCandidate> Candidates = { MakeCandidate(40, 4, 8), MakeCandidate(40, 4, 8) };
+		TestEqual(TEXT("Ties go to the earlier candidate"), FCandidate::PickBest(Candidates), 0);
+	}
+
+	{
+		const TArray<FCandidate> Candidates = { MakeCandidate(FCandidate::UnknownPingInMs, 4, 8) };
+		TestEqual(TEXT("Unknown ping is still joinable"), FCandidate::PickBest(Candidates), 0);
+	}
+
+	{
+		const TArray<FCandidate> Candidates = { MakeCandidate(FCandidate::UnknownPingInMs, 4, 8), MakeCandidate(20, 4, 8), MakeCandidate(500, 4, 8) };
+		TestEqual(TEXT("Unknown ping ranks below a good measured ping"), FCandidate::PickBest(Candidates), 1);
+		TestTrue(TEXT("Unknown ping ranks above a bad measured ping"), Candidates[0].GetScore() > Candidates[2].GetScore());
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -121,7 +121,7 @@ public:
 	UFUNCTION(BlueprintPure, Category = Sessions)
 	int32 GetMaxPublicConnections() const;
 
-	/** Ping to the search result, MAX_QUERY_PING is unreachable */
+	/** Ping to the search result, MAX_QUERY_PING if it wasn't measured */
 	UFUNCTION(BlueprintPure, Category=Sessions)
 	int32 GetPingInMs() const;
 
@@ -136,6 +136,37 @@ public:
 };
 
 
+//////////////////////////////////////////////////////////////////////
+// FCommonSession_QuickPlayCandidate
+
+/**
+ * The parts of a search result that quick play chooses between sessions with.
+ * This is kept free of the online system so the scoring can be run (and tested) over a plain list of candidates.
+ */
+struct COMMONUSER_API FCommonSession_QuickPlayCandidate
+{
+	/**
+	 * Ping at or above this means the ping is unknown (matches MAX_QUERY_PING, the default of search results on
+	 * online subsystems that don't measure ping, e.g. lobby searches).  These are scored as if they had UnknownPingScoredAsMs.
+	 */
+	static constexpr int32 UnknownPingInMs = 9999;
+	static constexpr int32 UnknownPingScoredAsMs = 100;
+
+	int32 PingInMs = 0;
+	int32 NumOpenPublicConnections = 0;
+	int32 MaxPublicConnections = 0;
+
+	/** Returns true if the session has a public slot left to join */
+	bool CanJoin() const { return NumOpenPublicConnections > 0; }
+
+	/** Returns the score for this candidate, higher is better.  Can be negative for high pings, check CanJoin separately. */
+	float GetScore() const;
+
+	/** Returns the index of the best joinable candidate or INDEX_NONE, ties go to the earlier candidate so the choice is deterministic */
+	static int32 PickBest(TArrayView<const FCommonSession_QuickPlayCandidate> Candidates);
+};
+
+
 //////////////////////////////////////////////////////////////////////
 // UCommonSession_SearchSessionRequest
 
@@ -232,6 +263,12 @@ protected:
 	/** Called when a quick play search finishes, can be overridden for game-specific behavior */
 	virtual void HandleQuickPlaySearchFinished(bool bSucceeded, const FText& ErrorMessage, TWeakObjectPtr<APlayerController> JoiningOrHostingPlayer, TStrongObjectPtr<UCommonSession_HostSessionRequest> HostRequest);
 
+	/** Fills in the quick play scoring inputs for a search result, can be overridden for game-specific behavior */
+	virtual FCommonSession_QuickPlayCandidate MakeQuickPlayCandidate(const UCommonSession_SearchResult* Result, const UCommonSession_HostSessionRequest* HostRequest) const;
+
+	/** Joins the best scoring result (removing it from the quick play cache), or hosts a new session if none can be joined */
+	void JoinBestQuickPlayResultOrHost(APlayerController* JoiningOrHostingPlayer, UCommonSession_HostSessionRequest* HostRequest, const TArray<UCommonSession_SearchResult*>& Results);
+
 	/** Called when traveling to a session fails */
 	virtual void TravelLocalSessionFailure(UWorld* World, ETravelFailure::Type FailureType, const FString& ReasonString);
 
@@ -253,6 +290,13 @@ protected:
 	void JoinSessionInternal(ULocalPlayer* LocalPlayer, UCommonSession_SearchResult* Request);
 	void InternalTravelToSession(const FName SessionName);
 
+	/** Returns a search result object from the pool, or a new one if the pool is empty */
+	UCommonSession_SearchResult* AcquireSearchResult();
+	/** Returns the cached quick play results to the pool */
+	void ReleaseQuickPlayResultCache();
+	/** Key describing what a quick play search was looking for, results are only reused for the same key */
+	static FString GetQuickPlayCacheKey(const UCommonSession_HostSessionRequest* HostRequest);
+
 #if COMMONUSER_OSSV1
 	void BindOnlineDelegatesOSSv1();
 	void CreateOnlineSessionInternalOSSv1(ULocalPlayer* LocalPlayer, UCommonSession_HostSessionRequest* Request);
@@ -298,4 +342,19 @@ protected:
 	/** Settings for the current host request */
 	TSharedPtr<FCommonSession_OnlineSessionSettings> HostSettings;
 
+	/** How long the results of a quick play search are reused for before searching again */
+	float QuickPlayResultCacheSeconds = 10.0f;
+
+	/** Results of the last quick play search that haven't been tried yet */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UCommonSession_SearchResult>> CachedQuickPlayResults;
+
+	/** What the cached quick play results were searched for, and when */
+	FString CachedQuickPlayKey;
+	double CachedQuickPlayTime = 0.0;
+
+	/** Search result objects that are no longer referenced by a request, reused by the next search */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UCommonSession_SearchResult>> SearchResultPool;
+
 };
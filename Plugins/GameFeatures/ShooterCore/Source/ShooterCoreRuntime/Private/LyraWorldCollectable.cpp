@@ -2,11 +2,32 @@
 
 #include "LyraWorldCollectable.h"
 #include "EngineUtils.h"
+#include "Interaction/LyraInteractionSubsystem.h"
 
 ALyraWorldCollectable::ALyraWorldCollectable()
 {
 }
 
+void ALyraWorldCollectable::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (ULyraInteractionSubsystem* InteractionSubsystem = UWorld::GetSubsystem<ULyraInteractionSubsystem>(GetWorld()))
+	{
+		InteractionSubsystem->RegisterInteractableTarget(this);
+	}
+}
+
+void ALyraWorldCollectable::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (ULyraInteractionSubsystem* InteractionSubsystem = UWorld::GetSubsystem<ULyraInteractionSubsystem>(GetWorld()))
+	{
+		InteractionSubsystem->UnregisterInteractableTarget(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ALyraWorldCollectable::GatherInteractionOptions(const FInteractionQuery& InteractQuery, FInteractionOptionBuilder& InteractionBuilder)
 {
 	InteractionBuilder.AddInteractionOption(Option);
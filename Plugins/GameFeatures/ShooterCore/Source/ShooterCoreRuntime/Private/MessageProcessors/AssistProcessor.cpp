@@ -6,11 +6,29 @@
 #include "Messages/LyraVerbMessage.h"
 #include "Messages/LyraVerbMessageHelpers.h"
 #include "GameFramework/PlayerState.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
 
 UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lyra_Elimination_Message, "Lyra.Elimination.Message");
 UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lyra_Damage_Message, "Lyra.Damage.Message");
 UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lyra_Assist_Message, "Lyra.Assist.Message");
 
+void FPlayerAssistDamageTracking::AddDamage(TObjectKey<APlayerState> Damager, float Damage)
+{
+	for (FPlayerAssistDamageEntry& Entry : AccumulatedDamageByPlayer)
+	{
+		if (Entry.Damager == Damager)
+		{
+			Entry.Damage += Damage;
+			return;
+		}
+	}
+
+	AccumulatedDamageByPlayer.Add({ Damager, Damage });
+}
+
+//////////////////////////////////////////////////////////////////////
+
 void UAssistProcessor::StartListening()
 {
 	UGameplayMessageSubsystem& MessageSubsystem = UGameplayMessageSubsystem::Get(this);
@@ -18,6 +36,28 @@ void UAssistProcessor::StartListening()
 	AddListenerHandle(MessageSubsystem.RegisterListener(TAG_Lyra_Damage_Message, this, &ThisClass::OnDamageMessage));
 }
 
+void UAssistProcessor::StopListening()
+{
+	Super::StopListening();
+
+	PendingDamage.Reset();
+	DamageHistory.Reset();
+}
+
+void UAssistProcessor::OnPlayerLoggedOut(APlayerState* PlayerState)
+{
+	const TObjectKey<APlayerState> PlayerKey(PlayerState);
+
+	FlushPendingDamage();
+
+	// Forget the damage dealt to them, and any damage they dealt to others
+	DamageHistory.Remove(PlayerKey);
+	for (auto& KVP : DamageHistory)
+	{
+		KVP.Value.AccumulatedDamageByPlayer.RemoveAllSwap([PlayerKey](const FPlayerAssistDamageEntry& Entry) { return Entry.Damager == PlayerKey; });
+	}
+}
+
 void UAssistProcessor::OnDamageMessage(FGameplayTag Channel, const FLyraVerbMessage& Payload)
 {
 	if (Payload.Instigator != Payload.Target)
@@ -26,25 +66,55 @@ void UAssistProcessor::OnDamageMessage(FGameplayTag Channel, const FLyraVerbMess
 		{
 			if (APlayerState* TargetPS = ULyraVerbMessageHelpers::GetPlayerStateFromObject(Payload.Target))
 			{
-				FPlayerAssistDamageTracking& Damage = DamageHistory.FindOrAdd(TargetPS);
-				float& DamageTotalFromTarget = Damage.AccumulatedDamageByPlayer.FindOrAdd(InstigatorPS);
-				DamageTotalFromTarget += Payload.Magnitude;
+				const TObjectKey<APlayerState> InstigatorKey(InstigatorPS);
+				const TObjectKey<APlayerState> TargetKey(TargetPS);
+
+				// A single shot can produce many damage messages in the same frame, so queue them up and
+				// only touch the damage history once per frame
+				if (PendingDamage.Num() == 0)
+				{
+					GetWorld()->GetTimerManager().SetTimerForNextTick(this, &ThisClass::FlushPendingDamage);
+				}
+
+				for (FPendingAssistDamage& Pending : PendingDamage)
+				{
+					if ((Pending.Instigator == InstigatorKey) && (Pending.Target == TargetKey))
+					{
+						Pending.Damage += Payload.Magnitude;
+						return;
+					}
+				}
+
+				PendingDamage.Add({ InstigatorKey, TargetKey, Payload.Magnitude });
 			}
 		}
 	}
 }
 
+void UAssistProcessor::FlushPendingDamage()
+{
+	for (const FPendingAssistDamage& Pending : PendingDamage)
+	{
+		DamageHistory.FindOrAdd(Pending.Target).AddDamage(Pending.Instigator, Pending.Damage);
+	}
+	PendingDamage.Reset();
+}
 
 void UAssistProcessor::OnEliminationMessage(FGameplayTag Channel, const FLyraVerbMessage& Payload)
 {
 	if (APlayerState* TargetPS = Cast<APlayerState>(Payload.Target))
 	{
+		// The damage that caused this elimination may still be queued up
+		FlushPendingDamage();
+
+		const TObjectKey<APlayerState> TargetKey(TargetPS);
+
 		// Grant an assist to each player who damaged the target but wasn't the instigator
-		if (FPlayerAssistDamageTracking* DamageOnTarget = DamageHistory.Find(TargetPS))
+		if (FPlayerAssistDamageTracking* DamageOnTarget = DamageHistory.Find(TargetKey))
 		{
-			for (const auto& KVP : DamageOnTarget->AccumulatedDamageByPlayer)
+			for (const FPlayerAssistDamageEntry& Entry : DamageOnTarget->AccumulatedDamageByPlayer)
 			{
-				if (APlayerState* AssistPS = KVP.Key)
+				if (APlayerState* AssistPS = Entry.Damager.ResolveObjectPtr())
 				{
 					if (AssistPS != Payload.Instigator)
 					{
@@ -56,7 +126,7 @@ void UAssistProcessor::OnEliminationMessage(FGameplayTag Channel, const FLyraVer
 						AssistMessage.Target = TargetPS;
 						AssistMessage.TargetTags = Payload.TargetTags;
 						AssistMessage.ContextTags = Payload.ContextTags;
-						AssistMessage.Magnitude = KVP.Value;
+						AssistMessage.Magnitude = Entry.Damage;
 
 						UGameplayMessageSubsystem& MessageSubsystem = UGameplayMessageSubsystem::Get(this);
 						MessageSubsystem.BroadcastMessage(AssistMessage.Verb, AssistMessage);
@@ -65,7 +135,7 @@ void UAssistProcessor::OnEliminationMessage(FGameplayTag Channel, const FLyraVer
 			}
 
 			// Clear the damage log for the eliminated player
-			DamageHistory.Remove(TargetPS);
+			DamageHistory.Remove(TargetKey);
 		}
 	}
 }
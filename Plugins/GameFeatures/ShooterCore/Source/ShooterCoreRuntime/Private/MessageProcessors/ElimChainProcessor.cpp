@@ -17,6 +17,11 @@ void UElimChainProcessor::StartListening()
 	AddListenerHandle(MessageSubsystem.RegisterListener(ElimChain::TAG_Lyra_Elimination_Message, this, &ThisClass::OnEliminationMessage));
 }
 
+void UElimChainProcessor::OnPlayerLoggedOut(APlayerState* PlayerState)
+{
+	PlayerChainHistory.Remove(PlayerState);
+}
+
 void UElimChainProcessor::OnEliminationMessage(FGameplayTag Channel, const FLyraVerbMessage& Payload)
 {
 	// Track elimination chains for the attacker (except for self-eliminations)
@@ -17,6 +17,11 @@ void UElimStreakProcessor::StartListening()
 	AddListenerHandle(MessageSubsystem.RegisterListener(ElimStreak::TAG_Lyra_Elimination_Message, this, &ThisClass::OnEliminationMessage));
 }
 
+void UElimStreakProcessor::OnPlayerLoggedOut(APlayerState* PlayerState)
+{
+	PlayerStreakHistory.Remove(PlayerState);
+}
+
 void UElimStreakProcessor::OnEliminationMessage(FGameplayTag Channel, const FLyraVerbMessage& Payload)
 {
 	// Track elimination streaks for the attacker (except for self-eliminations)
@@ -4,20 +4,26 @@
 
 #include "Messages/GameplayMessageProcessor.h"
 #include "GameplayTagContainer.h"
+#include "UObject/ObjectKey.h"
 #include "AssistProcessor.generated.h"
 
 struct FLyraVerbMessage;
 class APlayerState;
 
+// Damage dealt to a player by one other player
+struct FPlayerAssistDamageEntry
+{
+	TObjectKey<APlayerState> Damager;
+	float Damage = 0.0f;
+};
+
 // Tracks the damage done to a player by other players
-USTRUCT()
 struct FPlayerAssistDamageTracking
 {
-	GENERATED_BODY()
+	// Damage dealt by each damager, there are rarely more than a handful so this is a flat list
+	TArray<FPlayerAssistDamageEntry, TInlineAllocator<4>> AccumulatedDamageByPlayer;
 
-	// Map of damager to damage dealt
-	UPROPERTY(Transient)
-	TMap<TObjectPtr<APlayerState>, float> AccumulatedDamageByPlayer;
+	void AddDamage(TObjectKey<APlayerState> Damager, float Damage);
 };
 
 // Tracks assists (dealing damage to another player without finishing them)
@@ -28,13 +34,29 @@ class UAssistProcessor : public UGameplayMessageProcessor
 
 public:
 	virtual void StartListening() override;
+	virtual void StopListening() override;
+
+protected:
+	virtual void OnPlayerLoggedOut(APlayerState* PlayerState) override;
 
 private:
 	void OnDamageMessage(FGameplayTag Channel, const FLyraVerbMessage& Payload);
 	void OnEliminationMessage(FGameplayTag Channel, const FLyraVerbMessage& Payload);
 
+	// Applies the damage messages queued up since the last flush to DamageHistory
+	void FlushPendingDamage();
+
 private:
+	struct FPendingAssistDamage
+	{
+		TObjectKey<APlayerState> Instigator;
+		TObjectKey<APlayerState> Target;
+		float Damage = 0.0f;
+	};
+
+	// Damage messages received this frame (e.g., every pellet of a shotgun blast), merged per instigator/target pair
+	TArray<FPendingAssistDamage> PendingDamage;
+
 	// Map of player to damage dealt to them
-	UPROPERTY(Transient)
-	TMap<TObjectPtr<APlayerState>, FPlayerAssistDamageTracking> DamageHistory;
+	TMap<TObjectKey<APlayerState>, FPlayerAssistDamageTracking> DamageHistory;
 };
@@ -4,6 +4,7 @@
 
 #include "Messages/GameplayMessageProcessor.h"
 #include "GameplayTagContainer.h"
+#include "UObject/ObjectKey.h"
 #include "ElimChainProcessor.generated.h"
 
 struct FLyraVerbMessage;
@@ -29,6 +30,8 @@ public:
 	virtual void StartListening() override;
 
 protected:
+	virtual void OnPlayerLoggedOut(APlayerState* PlayerState) override;
+
 	UPROPERTY(EditDefaultsOnly)
 	float ChainTimeLimit = 4.5f;
 
@@ -40,6 +43,5 @@ private:
 	void OnEliminationMessage(FGameplayTag Channel, const FLyraVerbMessage& Payload);
 
 private:
-	UPROPERTY(Transient)
-	TMap<TObjectPtr<APlayerState>, FPlayerElimChainInfo> PlayerChainHistory;
+	TMap<TObjectKey<APlayerState>, FPlayerElimChainInfo> PlayerChainHistory;
 };
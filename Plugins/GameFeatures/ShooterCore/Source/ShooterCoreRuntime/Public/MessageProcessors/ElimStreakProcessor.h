@@ -4,6 +4,7 @@
 
 #include "Messages/GameplayMessageProcessor.h"
 #include "GameplayTagContainer.h"
+#include "UObject/ObjectKey.h"
 #include "ElimStreakProcessor.generated.h"
 
 struct FLyraVerbMessage;
@@ -19,6 +20,8 @@ public:
 	virtual void StartListening() override;
 
 protected:
+	virtual void OnPlayerLoggedOut(APlayerState* PlayerState) override;
+
 	// The event to rebroadcast when a user gets a streak of a certain length
 	UPROPERTY(EditDefaultsOnly)
 	TMap<int32, FGameplayTag> ElimStreakTags;
@@ -27,6 +30,5 @@ private:
 	void OnEliminationMessage(FGameplayTag Channel, const FLyraVerbMessage& Payload);
 
 private:
-	UPROPERTY(Transient)
-	TMap<TObjectPtr<APlayerState>, int32> PlayerStreakHistory;
+	TMap<TObjectKey<APlayerState>, int32> PlayerStreakHistory;
 };
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "TopDownArenaAttributeSet.h"
+#include "GameFramework/Actor.h"
 #include "Net/UnrealNetwork.h"
 
 UTopDownArenaAttributeSet::UTopDownArenaAttributeSet()
@@ -15,30 +16,69 @@ void UTopDownArenaAttributeSet::GetLifetimeReplicatedProps(TArray<FLifetimePrope
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME_CONDITION_NOTIFY(ThisClass, BombsRemaining, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(ThisClass, BombCapacity, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(ThisClass, BombRange, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(ThisClass, MovementSpeed, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME(ThisClass, ReplicatedArenaAttributes);
 }
 
-void UTopDownArenaAttributeSet::OnRep_BombsRemaining(const FGameplayAttributeData& OldValue)
+bool FTopDownArenaAttributeRepData::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 {
-	GAMEPLAYATTRIBUTE_REPNOTIFY(ThisClass, BombsRemaining, OldValue);
-}
+	for (int32 Index = 0; Index < 2; ++Index)
+	{
+		Ar << BombsRemaining[Index];
+		Ar << BombCapacity[Index];
+		Ar << BombRange[Index];
+		Ar << MovementSpeed[Index];
+	}
 
-void UTopDownArenaAttributeSet::OnRep_BombCapacity(const FGameplayAttributeData& OldValue)
-{
-	GAMEPLAYATTRIBUTE_REPNOTIFY(ThisClass, BombCapacity, OldValue);
+	bOutSuccess = true;
+	return true;
 }
 
-void UTopDownArenaAttributeSet::OnRep_BombRange(const FGameplayAttributeData& OldValue)
+void UTopDownArenaAttributeSet::OnRep_ArenaAttributes()
 {
-	GAMEPLAYATTRIBUTE_REPNOTIFY(ThisClass, BombRange, OldValue);
+	auto ApplyReplicatedValue = [this](FGameplayAttributeData& AttributeData, float BaseValue, float CurrentValue, auto&& NotifyAttribute)
+	{
+		if ((AttributeData.GetBaseValue() != BaseValue) || (AttributeData.GetCurrentValue() != CurrentValue))
+		{
+			const FGameplayAttributeData OldValue = AttributeData;
+			AttributeData.SetBaseValue(BaseValue);
+			AttributeData.SetCurrentValue(CurrentValue);
+			NotifyAttribute(OldValue);
+		}
+	};
+
+	const FTopDownArenaAttributeRepData& Data = ReplicatedArenaAttributes;
+	constexpr int32 Base = FTopDownArenaAttributeRepData::BaseIndex;
+	constexpr int32 Current = FTopDownArenaAttributeRepData::CurrentIndex;
+
+	ApplyReplicatedValue(BombCapacity, Data.BombCapacity[Base], Data.BombCapacity[Current], [this](const FGameplayAttributeData& OldValue) { GAMEPLAYATTRIBUTE_REPNOTIFY(ThisClass, BombCapacity, OldValue); });
+	ApplyReplicatedValue(BombsRemaining, Data.BombsRemaining[Base], Data.BombsRemaining[Current], [this](const FGameplayAttributeData& OldValue) { GAMEPLAYATTRIBUTE_REPNOTIFY(ThisClass, BombsRemaining, OldValue); });
+	ApplyReplicatedValue(BombRange, Data.BombRange[Base], Data.BombRange[Current], [this](const FGameplayAttributeData& OldValue) { GAMEPLAYATTRIBUTE_REPNOTIFY(ThisClass, BombRange, OldValue); });
+	ApplyReplicatedValue(MovementSpeed, Data.MovementSpeed[Base], Data.MovementSpeed[Current], [this](const FGameplayAttributeData& OldValue) { GAMEPLAYATTRIBUTE_REPNOTIFY(ThisClass, MovementSpeed, OldValue); });
 }
 
-void UTopDownArenaAttributeSet::OnRep_MovementSpeed(const FGameplayAttributeData& OldValue)
+void UTopDownArenaAttributeSet::UpdateReplicatedArenaAttributes()
 {
-	GAMEPLAYATTRIBUTE_REPNOTIFY(ThisClass, MovementSpeed, OldValue);
+	// Packing on a client would change what its next OnRep_ArenaAttributes compares against
+	const AActor* OwningActor = Cast<AActor>(GetOuter());
+	if ((OwningActor == nullptr) || !OwningActor->HasAuthority())
+	{
+		return;
+	}
+
+	auto PackByte = [](float Value) { return (uint8)FMath::Clamp(FMath::RoundToInt(Value), 0, (int32)MAX_uint8); };
+
+	FTopDownArenaAttributeRepData& Data = ReplicatedArenaAttributes;
+	constexpr int32 Base = FTopDownArenaAttributeRepData::BaseIndex;
+	constexpr int32 Current = FTopDownArenaAttributeRepData::CurrentIndex;
+
+	Data.BombsRemaining[Base] = PackByte(BombsRemaining.GetBaseValue());
+	Data.BombsRemaining[Current] = PackByte(BombsRemaining.GetCurrentValue());
+	Data.BombCapacity[Base] = PackByte(BombCapacity.GetBaseValue());
+	Data.BombCapacity[Current] = PackByte(BombCapacity.GetCurrentValue());
+	Data.BombRange[Base] = PackByte(BombRange.GetBaseValue());
+	Data.BombRange[Current] = PackByte(BombRange.GetCurrentValue());
+	Data.MovementSpeed[Base] = MovementSpeed.GetBaseValue();
+	Data.MovementSpeed[Current] = MovementSpeed.GetCurrentValue();
 }
 
 void UTopDownArenaAttributeSet::PreAttributeBaseChange(const FGameplayAttribute& Attribute, float& NewValue) const
@@ -55,6 +95,31 @@ void UTopDownArenaAttributeSet::PreAttributeChange(const FGameplayAttribute& Att
 	ClampAttribute(Attribute, NewValue);
 }
 
+void UTopDownArenaAttributeSet::PostAttributeBaseChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) const
+{
+	Super::PostAttributeBaseChange(Attribute, OldValue, NewValue);
+
+	// A base change does not always reach PostAttributeChange (e.g., when a modifier overrides the current value),
+	// the callback is const but ReplicatedArenaAttributes only mirrors the attributes
+	const_cast<ThisClass*>(this)->UpdateReplicatedArenaAttributes();
+}
+
+void UTopDownArenaAttributeSet::PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue)
+{
+	Super::PostAttributeChange(Attribute, OldValue, NewValue);
+
+	// Clients receive the result through OnRep_ArenaAttributes
+	UpdateReplicatedArenaAttributes();
+}
+
+void UTopDownArenaAttributeSet::InitFromMetaDataTable(const UDataTable* DataTable)
+{
+	Super::InitFromMetaDataTable(DataTable);
+
+	// The table sets the attribute data directly, without any of the change callbacks
+	UpdateReplicatedArenaAttributes();
+}
+
 void UTopDownArenaAttributeSet::ClampAttribute(const FGameplayAttribute& Attribute, float& NewValue) const
 {
 	if (Attribute == GetBombsRemainingAttribute())
@@ -7,6 +7,61 @@
 #include "NativeGameplayTags.h"
 #include "TopDownArenaAttributeSet.generated.h"
 
+/**
+ * FTopDownArenaAttributeRepData
+ *
+ *	All of the arena attributes packed together for replication.  The bomb attributes are small whole numbers and
+ *	fit in a byte each, the movement speed is sent at full precision so owning clients predict with the same speed
+ *	as the server.  The base and current values fit in 14 bytes.
+ */
+USTRUCT()
+struct FTopDownArenaAttributeRepData
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint8 BombsRemaining[2] = { 1, 1 };
+
+	UPROPERTY()
+	uint8 BombCapacity[2] = { 1, 1 };
+
+	UPROPERTY()
+	uint8 BombRange[2] = { 2, 2 };
+
+	UPROPERTY()
+	float MovementSpeed[2] = { 400.0f, 400.0f };
+
+	// Index into the arrays above
+	static constexpr int32 BaseIndex = 0;
+	static constexpr int32 CurrentIndex = 1;
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FTopDownArenaAttributeRepData> : public TStructOpsTypeTraitsBase2<FTopDownArenaAttributeRepData>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
+
+/**
+ * Like ATTRIBUTE_ACCESSORS, but the initter also packs the new value into ReplicatedArenaAttributes,
+ * since setting the attribute data directly skips the attribute change callbacks.
+ */
+#define ARENA_ATTRIBUTE_ACCESSORS(ClassName, PropertyName) \
+	GAMEPLAYATTRIBUTE_PROPERTY_GETTER(ClassName, PropertyName) \
+	GAMEPLAYATTRIBUTE_VALUE_GETTER(PropertyName) \
+	GAMEPLAYATTRIBUTE_VALUE_SETTER(PropertyName) \
+	void Init##PropertyName(float NewVal) \
+	{ \
+		PropertyName.SetBaseValue(NewVal); \
+		PropertyName.SetCurrentValue(NewVal); \
+		UpdateReplicatedArenaAttributes(); \
+	}
+
 /**
  * UTopDownArenaAttributeSet
  *
@@ -20,46 +75,47 @@ class UTopDownArenaAttributeSet : public ULyraAttributeSet
 public:
 	UTopDownArenaAttributeSet();
 
-	ATTRIBUTE_ACCESSORS(ThisClass, BombsRemaining);
-	ATTRIBUTE_ACCESSORS(ThisClass, BombCapacity);
-	ATTRIBUTE_ACCESSORS(ThisClass, BombRange);
-	ATTRIBUTE_ACCESSORS(ThisClass, MovementSpeed);
+	ARENA_ATTRIBUTE_ACCESSORS(ThisClass, BombsRemaining);
+	ARENA_ATTRIBUTE_ACCESSORS(ThisClass, BombCapacity);
+	ARENA_ATTRIBUTE_ACCESSORS(ThisClass, BombRange);
+	ARENA_ATTRIBUTE_ACCESSORS(ThisClass, MovementSpeed);
 
 	//~UAttributeSet interface
 	virtual void PreAttributeBaseChange(const FGameplayAttribute& Attribute, float& NewValue) const override;
 	virtual void PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue) override;
+	virtual void PostAttributeBaseChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) const override;
+	virtual void PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) override;
+	virtual void InitFromMetaDataTable(const UDataTable* DataTable) override;
 	//~End of UAttributeSet interface
 
 protected:
 
 	UFUNCTION()
-	void OnRep_BombsRemaining(const FGameplayAttributeData& OldValue);
-
-	UFUNCTION()
-	void OnRep_BombCapacity(const FGameplayAttributeData& OldValue);
-
-	UFUNCTION()
-	void OnRep_BombRange(const FGameplayAttributeData& OldValue);
-	
-	UFUNCTION()
-	void OnRep_MovementSpeed(const FGameplayAttributeData& OldValue);
+	void OnRep_ArenaAttributes();
 
 	void ClampAttribute(const FGameplayAttribute& Attribute, float& NewValue) const;
 
+	// Packs the attributes into ReplicatedArenaAttributes, does nothing on clients, which only receive it
+	void UpdateReplicatedArenaAttributes();
+
 private:
 	// The number of bombs remaining
-	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_BombsRemaining, Category="TopDownArenaGame", Meta=(AllowPrivateAccess=true))
+	UPROPERTY(BlueprintReadOnly, Category="TopDownArenaGame", Meta=(AllowPrivateAccess=true))
 	FGameplayAttributeData BombsRemaining;
 
 	// The maximum number of bombs that can be placed at once
-	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_BombCapacity, Category="TopDownArenaGame", Meta=(AllowPrivateAccess=true))
+	UPROPERTY(BlueprintReadOnly, Category="TopDownArenaGame", Meta=(AllowPrivateAccess=true))
 	FGameplayAttributeData BombCapacity;
 
 	// The range/radius of bomb blasts
-	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_BombRange, Category="TopDownArenaGame", Meta=(AllowPrivateAccess=true))
+	UPROPERTY(BlueprintReadOnly, Category="TopDownArenaGame", Meta=(AllowPrivateAccess=true))
 	FGameplayAttributeData BombRange;
 
-	// The range/radius of bomb blasts
-	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_MovementSpeed, Category="TopDownArenaGame", Meta=(AllowPrivateAccess=true))
+	// The maximum movement speed
+	UPROPERTY(BlueprintReadOnly, Category="TopDownArenaGame", Meta=(AllowPrivateAccess=true))
 	FGameplayAttributeData MovementSpeed;
+
+	// The attributes above are replicated together through this rather than one property each
+	UPROPERTY(ReplicatedUsing=OnRep_ArenaAttributes)
+	FTopDownArenaAttributeRepData ReplicatedArenaAttributes;
 };
@@ -1,10 +1,9 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "TopDownArenaMovementComponent.h"
-#include "GameplayAbilities/Public/AbilitySystemGlobals.h"
-// #include "GameFramework/Character.h"
-// #include "CollisionQueryParams.h"
-// #include "Components/CapsuleComponent.h"
+#include "AbilitySystemComponent.h"
+#include "GameFramework/Character.h"
+#include "Character/LyraPawnExtensionComponent.h"
 #include "TopDownArenaAttributeSet.h"
 
 UTopDownArenaMovementComponent::UTopDownArenaMovementComponent(const FObjectInitializer& ObjectInitializer)
@@ -12,24 +11,124 @@ UTopDownArenaMovementComponent::UTopDownArenaMovementComponent(const FObjectInit
 {
 }
 
-float UTopDownArenaMovementComponent::GetMaxSpeed() const
+void UTopDownArenaMovementComponent::InitializeComponent()
 {
-	if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(GetOwner()))
+	Super::InitializeComponent();
+
+	if (bUseLightweightArenaMovement)
 	{
-		if (MovementMode == MOVE_Walking)
-		{
-			if (ASC->HasMatchingGameplayTag(TAG_Gameplay_MovementStopped))
-			{
-				return 0;
-			}
+		bEnablePhysicsInteraction = false;
+		bAlwaysCheckFloor = false;
+		bUseFlatBaseForFloorChecks = true;
+		NetworkSmoothingMode = ENetworkSmoothingMode::Linear;
 
-			const float MaxSpeedFromAttribute = ASC->GetNumericAttribute(UTopDownArenaAttributeSet::GetMovementSpeedAttribute());
-			if (MaxSpeedFromAttribute > 0.0f)
+		if (ACharacter* Character = GetCharacterOwner())
+		{
+			if (Character->HasAuthority())
 			{
-				return MaxSpeedFromAttribute;
+				Character->NetUpdateFrequency = FMath::Min(Character->NetUpdateFrequency, LightweightNetUpdateFrequency);
 			}
 		}
 	}
+}
+
+void UTopDownArenaMovementComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (ULyraPawnExtensionComponent* PawnExtComponent = ULyraPawnExtensionComponent::FindPawnExtensionComponent(GetOwner()))
+	{
+		PawnExtComponent->OnAbilitySystemInitialized_RegisterAndCall(FSimpleMulticastDelegate::FDelegate::CreateUObject(this, &ThisClass::OnAbilitySystemInitialized));
+		PawnExtComponent->OnAbilitySystemUninitialized_Register(FSimpleMulticastDelegate::FDelegate::CreateUObject(this, &ThisClass::OnAbilitySystemUninitialized));
+	}
+}
+
+void UTopDownArenaMovementComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnbindFromAbilitySystem();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UTopDownArenaMovementComponent::OnAbilitySystemInitialized()
+{
+	const ULyraPawnExtensionComponent* PawnExtComponent = ULyraPawnExtensionComponent::FindPawnExtensionComponent(GetOwner());
+	UAbilitySystemComponent* ASC = PawnExtComponent ? PawnExtComponent->GetLyraAbilitySystemComponent() : nullptr;
+	if (ASC == BoundAbilitySystem.Get())
+	{
+		return;
+	}
+
+	UnbindFromAbilitySystem();
+
+	if (ASC)
+	{
+		BoundAbilitySystem = ASC;
+		MovementSpeedChangedHandle = ASC->GetGameplayAttributeValueChangeDelegate(UTopDownArenaAttributeSet::GetMovementSpeedAttribute()).AddUObject(this, &ThisClass::OnMovementSpeedChanged);
+		MovementStoppedTagHandle = ASC->RegisterGameplayTagEvent(TAG_Gameplay_MovementStopped, EGameplayTagEventType::NewOrRemoved).AddUObject(this, &ThisClass::OnMovementStoppedTagChanged);
+
+		CachedArenaMaxSpeed = ASC->GetNumericAttribute(UTopDownArenaAttributeSet::GetMovementSpeedAttribute());
+		bArenaMovementStopped = ASC->HasMatchingGameplayTag(TAG_Gameplay_MovementStopped);
+	}
+}
+
+void UTopDownArenaMovementComponent::OnAbilitySystemUninitialized()
+{
+	UnbindFromAbilitySystem();
+}
+
+void UTopDownArenaMovementComponent::UnbindFromAbilitySystem()
+{
+	if (UAbilitySystemComponent* ASC = BoundAbilitySystem.Get())
+	{
+		ASC->GetGameplayAttributeValueChangeDelegate(UTopDownArenaAttributeSet::GetMovementSpeedAttribute()).Remove(MovementSpeedChangedHandle);
+		ASC->RegisterGameplayTagEvent(TAG_Gameplay_MovementStopped, EGameplayTagEventType::NewOrRemoved).Remove(MovementStoppedTagHandle);
+	}
+
+	BoundAbilitySystem.Reset();
+	MovementSpeedChangedHandle.Reset();
+	MovementStoppedTagHandle.Reset();
+	CachedArenaMaxSpeed = 0.0f;
+	bArenaMovementStopped = false;
+}
+
+void UTopDownArenaMovementComponent::OnMovementSpeedChanged(const FOnAttributeChangeData& ChangeData)
+{
+	CachedArenaMaxSpeed = ChangeData.NewValue;
+}
+
+void UTopDownArenaMovementComponent::OnMovementStoppedTagChanged(const FGameplayTag Tag, int32 NewCount)
+{
+	bArenaMovementStopped = (NewCount > 0);
+}
+
+FRotator UTopDownArenaMovementComponent::GetDeltaRotation(float DeltaTime) const
+{
+	if (bArenaMovementStopped)
+	{
+		return FRotator(0,0,0);
+	}
+
+	// Skip the ability system lookup in the base class, the tag is already cached above
+	return UCharacterMovementComponent::GetDeltaRotation(DeltaTime);
+}
+
+float UTopDownArenaMovementComponent::GetMaxSpeed() const
+{
+	if (!BoundAbilitySystem.IsValid())
+	{
+		return Super::GetMaxSpeed();
+	}
 
-	return Super::GetMaxSpeed();
-}
\ No newline at end of file
+	if (bArenaMovementStopped)
+	{
+		return 0;
+	}
+
+	if ((MovementMode == MOVE_Walking) && (CachedArenaMaxSpeed > 0.0f))
+	{
+		return CachedArenaMaxSpeed;
+	}
+
+	return UCharacterMovementComponent::GetMaxSpeed();
+}
@@ -4,8 +4,18 @@
 
 #include "CoreMinimal.h"
 #include "Character/LyraCharacterMovementComponent.h"
+#include "GameplayEffectTypes.h"
 #include "TopDownArenaMovementComponent.generated.h"
 
+class UAbilitySystemComponent;
+
+/**
+ * UTopDownArenaMovementComponent
+ *
+ *	Movement for the top down arena.  The arena can have a lot of pawns moving over flat ground at once, so the
+ *	movement speed and stopped state are cached from ability system callbacks instead of being queried every move,
+ *	and the lightweight settings below trade physics interaction and floor checks for a cheaper tick.
+ */
 UCLASS()
 class UTopDownArenaMovementComponent : public ULyraCharacterMovementComponent
 {
@@ -15,8 +25,48 @@ public:
 
 	UTopDownArenaMovementComponent(const FObjectInitializer& ObjectInitializer);
 
+	//~UActorComponent interface
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	//~End of UActorComponent interface
+
 	//~UMovementComponent interface
+	virtual FRotator GetDeltaRotation(float DeltaTime) const override;
 	virtual float GetMaxSpeed() const override;
 	//~End of UMovementComponent interface
 
+protected:
+
+	virtual void InitializeComponent() override;
+
+	// Called by the pawn extension component when the pawn's ability system is set up or torn down (e.g., on possession)
+	void OnAbilitySystemInitialized();
+	void OnAbilitySystemUninitialized();
+
+	void UnbindFromAbilitySystem();
+
+	void OnMovementSpeedChanged(const FOnAttributeChangeData& ChangeData);
+	void OnMovementStoppedTagChanged(const FGameplayTag Tag, int32 NewCount);
+
+protected:
+
+	// Disables physics interaction and per-move floor sweeps and uses linear network smoothing and a lower
+	// net update rate, which is enough for pawns walking around the flat arena floor
+	UPROPERTY(EditDefaultsOnly, Category="Arena Movement")
+	bool bUseLightweightArenaMovement = true;
+
+	// Net update frequency used for the owning pawn when lightweight movement is enabled
+	UPROPERTY(EditDefaultsOnly, Category="Arena Movement", meta=(EditCondition="bUseLightweightArenaMovement", ClampMin=1.0))
+	float LightweightNetUpdateFrequency = 30.0f;
+
+private:
+
+	TWeakObjectPtr<UAbilitySystemComponent> BoundAbilitySystem;
+	FDelegateHandle MovementSpeedChangedHandle;
+	FDelegateHandle MovementStoppedTagHandle;
+
+	// MovementSpeed attribute value, or 0 if there is no ability system yet
+	float CachedArenaMaxSpeed = 0.0f;
+
+	bool bArenaMovementStopped = false;
 };
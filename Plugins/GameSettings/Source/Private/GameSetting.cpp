@@ -33,6 +33,8 @@ namespace GameSettingsConsoleVars
 // UGameSetting
 //--------------------------------------
 
+uint32 UGameSetting::FilterableStateSerial = 0;
+
 void UGameSetting::Initialize(ULocalPlayer* InLocalPlayer)
 {
 	// If we've already gotten this local player we're already initialized.
@@ -140,6 +142,12 @@ const FString& UGameSetting::GetDescriptionPlainText() const
 	return AutoGenerated_DescriptionPlainText;
 }
 
+const FString& UGameSetting::GetSearchIndexText() const
+{
+	RefreshPlainText();
+	return AutoGenerated_SearchIndexText;
+}
+
 void UGameSetting::RefreshPlainText() const
 {
 	//TODO: GameSettings
@@ -167,6 +175,8 @@ void UGameSetting::RefreshPlainText() const
 			}
 		}
 
+		AutoGenerated_SearchIndexText = AutoGenerated_DescriptionPlainText.ToLower();
+
 		bRefreshPlainSearchableText = false;
 	}
 }
@@ -229,8 +239,17 @@ void UGameSetting::RefreshEditableState(bool bNotifyEditConditionsChanged)
 	{
 		TGuardValue<bool> Guard(bOnEditConditionsChangedEventGuard, true);
 	
+		const FGameSettingEditableState PreviousState = EditableStateCache;
 		EditableStateCache = ComputeEditableState();
 
+		// Filtering only looks at these, even when nobody is notified of the change
+		if ((PreviousState.IsVisible() != EditableStateCache.IsVisible()) ||
+			(PreviousState.IsEnabled() != EditableStateCache.IsEnabled()) ||
+			(PreviousState.IsResetable() != EditableStateCache.IsResetable()))
+		{
+			++FilterableStateSerial;
+		}
+
 		if (bNotifyEditConditionsChanged)
 		{
 			NotifyEditConditionsChanged();
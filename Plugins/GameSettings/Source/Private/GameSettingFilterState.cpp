@@ -4,6 +4,7 @@
 #include "Misc/TextFilterExpressionEvaluator.h"
 #include "Misc/TextFilterUtils.h"
 #include "GameSetting.h"
+#include "Algo/AllOf.h"
 
 #define LOCTEXT_NAMESPACE "GameSetting"
 
@@ -49,7 +50,23 @@ void FGameSettingFilterState::AddSettingToAllowList(UGameSetting* InSetting)
 
 void FGameSettingFilterState::SetSearchText(const FString& InSearchText)
 {
+	SearchText = InSearchText;
 	SearchTextEvaluator.SetFilterText(FText::FromString(InSearchText));
+
+	// Anything beyond a single word (quotes, operators, multiple terms) goes through the expression evaluator
+	const bool bIsSimpleTerm = !InSearchText.IsEmpty() && Algo::AllOf(InSearchText, [](TCHAR Char) { return FChar::IsAlnum(Char) || (Char == TEXT('_')); });
+	SimpleSearchTermLower = bIsSimpleTerm ? InSearchText.ToLower() : FString();
+}
+
+bool FGameSettingFilterState::IsEquivalentTo(const FGameSettingFilterState& Other) const
+{
+	return (bIncludeDisabled == Other.bIncludeDisabled) &&
+		(bIncludeHidden == Other.bIncludeHidden) &&
+		(bIncludeResetable == Other.bIncludeResetable) &&
+		(bIncludeNestedPages == Other.bIncludeNestedPages) &&
+		SearchText.Equals(Other.SearchText, ESearchCase::CaseSensitive) &&
+		(SettingRootList == Other.SettingRootList) &&
+		(SettingAllowList == Other.SettingAllowList);
 }
 
 bool FGameSettingFilterState::DoesSettingPassFilter(const UGameSetting& InSetting) const
@@ -99,7 +116,14 @@ bool FGameSettingFilterState::DoesSettingPassFilter(const UGameSetting& InSettin
 	// TODO more filters...
 
 	// Always search text last, it's generally the most expensive filter.
-	if (!SearchTextEvaluator.TestTextFilter(FSettingFilterExpressionContext(InSetting)))
+	if (!SimpleSearchTermLower.IsEmpty())
+	{
+		if (!InSetting.GetSearchIndexText().Contains(SimpleSearchTermLower, ESearchCase::CaseSensitive))
+		{
+			return false;
+		}
+	}
+	else if (!SearchText.IsEmpty() && !SearchTextEvaluator.TestTextFilter(FSettingFilterExpressionContext(InSetting)))
 	{
 		return false;
 	}
@@ -34,6 +34,7 @@ void UGameSettingRegistry::Regenerate()
 	}
 	RegisteredSettings.Reset();
 	TopLevelSettings.Reset();
+	InvalidateFilterCache();
 
 	OnInitialize(OwningLocalPlayer);
 }
@@ -60,6 +61,32 @@ void UGameSettingRegistry::SaveChanges()
 
 void UGameSettingRegistry::GetSettingsForFilter(const FGameSettingFilterState& FilterState, TArray<UGameSetting*>& InOutSettings)
 {
+	// Some edit state refreshes don't notify anyone, so also check whether anything filterable changed since we cached
+	if (FilterResultCacheSerial != UGameSetting::GetFilterableStateSerial())
+	{
+		InvalidateFilterCache();
+	}
+
+	for (int32 CacheIndex = FilterResultCache.Num() - 1; CacheIndex >= 0; --CacheIndex)
+	{
+		if (FilterResultCache[CacheIndex].FilterState.IsEquivalentTo(FilterState))
+		{
+			InOutSettings.Append(FilterResultCache[CacheIndex].Settings);
+
+			// Keep the most recently used result at the end so it's found first and evicted last
+			if (CacheIndex != FilterResultCache.Num() - 1)
+			{
+				FCachedFilterResult CachedResult = MoveTemp(FilterResultCache[CacheIndex]);
+				FilterResultCache.RemoveAt(CacheIndex);
+				FilterResultCache.Add(MoveTemp(CachedResult));
+			}
+			return;
+		}
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_UGameSettingRegistry_GetSettingsForFilter);
+
+	TArray<UGameSetting*> FilteredSettings;
 	TArray<UGameSetting*> RootSettings;
 	if (FilterState.GetSettingRootList().Num() > 0)
 	{
@@ -74,16 +101,30 @@ void UGameSettingRegistry::GetSettingsForFilter(const FGameSettingFilterState& F
 	{
 		if (const UGameSettingCollection* TopLevelCollection = Cast<UGameSettingCollection>(TopLevelSetting))
 		{
-			TopLevelCollection->GetSettingsForFilter(FilterState, InOutSettings);
+			TopLevelCollection->GetSettingsForFilter(FilterState, FilteredSettings);
 		}
 		else
 		{
 			if (FilterState.DoesSettingPassFilter(*TopLevelSetting))
 			{
-				InOutSettings.Add(TopLevelSetting);
+				FilteredSettings.Add(TopLevelSetting);
 			}
 		}
 	}
+
+	InOutSettings.Append(FilteredSettings);
+
+	if (FilterResultCache.Num() >= MaxCachedFilterResults)
+	{
+		FilterResultCache.RemoveAt(0);
+	}
+	FilterResultCache.Add({ FilterState, MoveTemp(FilteredSettings) });
+}
+
+void UGameSettingRegistry::InvalidateFilterCache()
+{
+	FilterResultCache.Reset();
+	FilterResultCacheSerial = UGameSetting::GetFilterableStateSerial();
 }
 
 UGameSetting* UGameSettingRegistry::FindSettingByDevName(const FName& SettingDevName)
@@ -106,6 +147,7 @@ void UGameSettingRegistry::RegisterSetting(UGameSetting* InSetting)
 		TopLevelSettings.Add(InSetting);
 		InSetting->SetRegistry(this);
 		RegisterInnerSettings(InSetting);
+		InvalidateFilterCache();
 	}
 }
 
@@ -140,11 +182,13 @@ void UGameSettingRegistry::RegisterInnerSettings(UGameSetting* InSetting)
 
 void UGameSettingRegistry::HandleSettingChanged(UGameSetting* Setting, EGameSettingChangeReason Reason)
 {
+	InvalidateFilterCache();
 	OnSettingChangedEvent.Broadcast(Setting, Reason);
 }
 
 void UGameSettingRegistry::HandleSettingEditConditionsChanged(UGameSetting* Setting)
 {
+	InvalidateFilterCache();
 	OnSettingEditConditionChangedEvent.Broadcast(Setting);
 }
 
@@ -0,0 +1,95 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Tests/GameSettingTestRegistry.h"
+#include "GameSettingAction.h"
+#include "GameSettingCollection.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGameSettingFilterCacheTest, "GameSettings.Registry.FilterCache", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FGameSettingFilterCacheTest::RunTest(const FString& Parameters)
+{
+	const int32 NumCollections = 20;
+	const int32 NumSettingsPerCollection = 100;
+	const int32 NumSettings = NumCollections * NumSettingsPerCollection;
+
+	// Every tenth setting mentions brightness, so searching for it lets 10% of the registry through
+	UGameSettingTestRegistry* Registry = NewObject<UGameSettingTestRegistry>();
+	for (int32 CollectionIndex = 0; CollectionIndex < NumCollections; CollectionIndex++)
+	{
+		UGameSettingCollection* Collection = NewObject<UGameSettingCollection>(Registry);
+		Collection->SetDevName(*FString::Printf(TEXT("Collection_%d"), CollectionIndex));
+
+		for (int32 SettingIndex = 0; SettingIndex < NumSettingsPerCollection; SettingIndex++)
+		{
+			const int32 GlobalIndex = (CollectionIndex * NumSettingsPerCollection) + SettingIndex;
+
+			UGameSettingAction* Setting = NewObject<UGameSettingAction>(Registry);
+			Setting->SetDevName(*FString::Printf(TEXT("Setting_%d"), GlobalIndex));
+			Setting->SetDescriptionRichText(FString::Printf(TEXT("Synthetic setting %d adjusts the %s of the game."), GlobalIndex, ((GlobalIndex % 10) == 0) ? TEXT("<b>Brightness</>") : TEXT("volume")));
+			Collection->AddSetting(Setting);
+		}
+
+		Registry->AddTestSetting(Collection);
+	}
+
+	auto MakeFilter = [](const FString& SearchText)
+	{
+		FGameSettingFilterState FilterState;
+		FilterState.SetSearchText(SearchText);
+		return FilterState;
+	};
+
+	auto GetSettings = [Registry](const FGameSettingFilterState& FilterState)
+	{
+		TArray<UGameSetting*> Settings;
+		Registry->GetSettingsForFilter(FilterState, Settings);
+		return Settings;
+	};
+
+	const FGameSettingFilterState EmptyFilter = MakeFilter(FString());
+	const FGameSettingFilterState SearchFilter = MakeFilter(TEXT("brightness"));
+
+	// Results
+	{
+		const TArray<UGameSetting*> Uncached = GetSettings(EmptyFilter);
+		TestEqual(TEXT("An empty search lets every setting through"), Uncached.Num(), NumSettings);
+		TestTrue(TEXT("A cached empty search returns the same settings"), GetSettings(MakeFilter(FString())) == Uncached);
+	}
+
+	{
+		const TArray<UGameSetting*> Uncached = GetSettings(SearchFilter);
+		TestEqual(TEXT("A simple search matches the plain text description"), Uncached.Num(), NumSettings / 10);
+		TestTrue(TEXT("A cached simple search returns the same settings"), GetSettings(MakeFilter(TEXT("brightness"))) == Uncached);
+		TestTrue(TEXT("A simple search ignores case"), GetSettings(MakeFilter(TEXT("BRIGHTNESS"))) == Uncached);
+		TestTrue(TEXT("The expression evaluator agrees with the simple search"), GetSettings(MakeFilter(TEXT("brightness game"))) == Uncached);
+	}
+
+	{
+		TArray<UGameSetting*> Settings = { Registry->FindSettingByDevName(TEXT("Setting_0")) };
+		Registry->GetSettingsForFilter(SearchFilter, Settings);
+		TestEqual(TEXT("A cache hit appends to the existing settings"), Settings.Num(), (NumSettings / 10) + 1);
+	}
+
+	// Invalidation
+	{
+		UGameSetting* Setting = Registry->FindSettingByDevName(TEXT("Setting_1"));
+		Setting->SetDescriptionRichText(TEXT("Now about brightness too."));
+		TestTrue(TEXT("Changing a description drops the cached search"), GetSettings(SearchFilter).Contains(Setting));
+
+		Setting->SetDescriptionRichText(TEXT("Back to volume."));
+		TestFalse(TEXT("Changing it back drops the cached search again"), GetSettings(SearchFilter).Contains(Setting));
+	}
+
+	{
+		const TArray<UGameSetting*> Cached = GetSettings(SearchFilter);
+		Registry->InvalidateFilterCache();
+		TestTrue(TEXT("Invalidating the whole cache gives the same settings"), GetSettings(SearchFilter) == Cached);
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,27 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameSettingRegistry.h"
+
+#include "GameSettingTestRegistry.generated.h"
+
+//--------------------------------------
+// UGameSettingTestRegistry
+//--------------------------------------
+
+/**
+ * Registry the automation tests fill with synthetic settings, without needing a local player.
+ */
+UCLASS(Transient, HideDropdown)
+class UGameSettingTestRegistry : public UGameSettingRegistry
+{
+	GENERATED_BODY()
+
+public:
+	void AddTestSetting(UGameSetting* InSetting) { RegisterSetting(InSetting); }
+
+protected:
+	virtual void OnInitialize(ULocalPlayer* InLocalPlayer) override { }
+};
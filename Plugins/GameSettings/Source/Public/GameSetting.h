@@ -77,6 +77,12 @@ public:
 	/** Gets the searchable plain text for the description. */
 	const FString& GetDescriptionPlainText() const;
 
+	/** Gets the lowercase plain text description, used as the search index for simple search terms. */
+	const FString& GetSearchIndexText() const;
+
+	/** Changes whenever the edit state or searchable text of any setting changes, so cached filter results can tell they are stale. */
+	static uint32 GetFilterableStateSerial() { return FilterableStateSerial; }
+
 	/** Initializes the setting, giving it the owning local player.  Containers automatically initialize settings added to them. */
 	void Initialize(ULocalPlayer* InLocalPlayer);
 
@@ -173,7 +179,7 @@ protected:
 
 	/** Regenerates the plain searchable text if it has been dirtied. */
 	void RefreshPlainText() const;
-	void InvalidateSearchableText() { bRefreshPlainSearchableText = true; }
+	void InvalidateSearchableText() { bRefreshPlainSearchableText = true; ++FilterableStateSerial; }
 
 	/** Notify that the setting changed */
 	void NotifySettingChanged(EGameSettingChangeReason Reason);
@@ -229,6 +235,8 @@ protected:
 	mutable bool bRefreshPlainSearchableText = true;
 	/** When we set the rich text for a setting, we automatically generate the plain text. */
 	mutable FString AutoGenerated_DescriptionPlainText;
+	/** Lowercase copy of the plain text, generated along with it. */
+	mutable FString AutoGenerated_SearchIndexText;
 
 	/** Report as part of analytics, by default no setting reports, except GameSettingValues. */
 	bool bReportAnalytics = false;
@@ -249,4 +257,6 @@ private:
 
 	/** We cache the editable state of a setting when it changes rather than reprocessing it any time it's needed.  */
 	FGameSettingEditableState EditableStateCache;
+
+	static uint32 FilterableStateSerial;
 };
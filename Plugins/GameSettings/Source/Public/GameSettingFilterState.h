@@ -50,6 +50,9 @@ public:
 
 	bool DoesSettingPassFilter(const UGameSetting& InSetting) const;
 
+	/** Returns true if the other filter state would let exactly the same settings through. */
+	bool IsEquivalentTo(const FGameSettingFilterState& Other) const;
+
 	void AddSettingToRootList(UGameSetting* InSetting);
 	void AddSettingToAllowList(UGameSetting* InSetting);
 
@@ -67,6 +70,11 @@ public:
 private:
 	FTextFilterExpressionEvaluator SearchTextEvaluator;
 
+	FString SearchText;
+
+	/** If the search text is a single plain word, it's matched directly against each setting's lowercase search index. */
+	FString SimpleSearchTermLower;
+
 	UPROPERTY()
 	TArray<UGameSetting*> SettingRootList;
 
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "UObject/ObjectMacros.h"
 #include "GameplayTagContainer.h"
+#include "GameSettingFilterState.h"
 
 #include "GameSettingRegistry.generated.h"
 
@@ -14,8 +15,6 @@
 
 class ULocalPlayer;
 class UGameSetting;
-struct FGameSettingFilterState;
-enum class EGameSettingChangeReason : uint8;
 
 /**
  * 
@@ -50,8 +49,12 @@ public:
 
 	virtual void SaveChanges();
 	
+	/** Appends the settings that pass the filter.  Results are cached until a setting or its edit conditions change. */
 	void GetSettingsForFilter(const FGameSettingFilterState& FilterState, TArray<UGameSetting*>& InOutSettings);
 
+	/** Drops the cached filter results, e.g. after changing something that affects filtering without a setting change notification. */
+	void InvalidateFilterCache();
+
 	UGameSetting* FindSettingByDevName(const FName& SettingDevName);
 
 	template<typename T = UGameSetting>
@@ -82,4 +85,19 @@ protected:
 
 	UPROPERTY(Transient)
 	ULocalPlayer* OwningLocalPlayer;
+
+private:
+	struct FCachedFilterResult
+	{
+		FGameSettingFilterState FilterState;
+		TArray<UGameSetting*> Settings;
+	};
+
+	/** Results of recent GetSettingsForFilter calls, most recently used last. */
+	TArray<FCachedFilterResult> FilterResultCache;
+
+	/** UGameSetting::GetFilterableStateSerial() when the cached results were computed. */
+	uint32 FilterResultCacheSerial = 0;
+
+	static constexpr int32 MaxCachedFilterResults = 8;
 };
@@ -23,11 +23,15 @@ void UMediaSubtitlesPlayer::BeginDestroy()
 void UMediaSubtitlesPlayer::Play()
 {
 	bEnabled = true;
+
+	// Localized overlays can return different cues after a culture change, always start from fresh ones
+	RebuildCueTimeline();
 }
 
 void UMediaSubtitlesPlayer::Stop()
 {
 	bEnabled = false;
+	CueTimeline.Rewind();
 
 	// Clear the movie subtitle for this object
 	FSubtitleManager::GetSubtitleManager()->SetMovieSubtitle(this, TArray<FString>());
@@ -36,6 +40,7 @@ void UMediaSubtitlesPlayer::Stop()
 void UMediaSubtitlesPlayer::SetSubtitles(UOverlays* Subtitles)
 {
 	SourceSubtitles = Subtitles;
+	RebuildCueTimeline();
 }
 
 void UMediaSubtitlesPlayer::BindToMediaPlayer(UMediaPlayer* InMediaPlayer)
@@ -43,6 +48,34 @@ void UMediaSubtitlesPlayer::BindToMediaPlayer(UMediaPlayer* InMediaPlayer)
 	MediaPlayer = InMediaPlayer;
 }
 
+void UMediaSubtitlesPlayer::RebuildCueTimeline()
+{
+	CueTimelineSource = SourceSubtitles;
+
+	if (SourceSubtitles)
+	{
+		TArray<FSubtitleCue> Cues;
+		for (FOverlayItem& Overlay : SourceSubtitles->GetAllOverlays())
+		{
+			FSubtitleCue& Cue = Cues.AddDefaulted_GetRef();
+			Cue.StartTime = Overlay.StartTime;
+			Cue.EndTime = Overlay.EndTime;
+			Cue.Text = MoveTemp(Overlay.Text);
+		}
+		CueTimeline.SetCues(MoveTemp(Cues));
+	}
+	else
+	{
+		CueTimeline.Empty();
+	}
+}
+
+void UMediaSubtitlesPlayer::UpdateMovieSubtitle()
+{
+	CueTimeline.GetActiveText(ActiveSubtitlesText);
+	FSubtitleManager::GetSubtitleManager()->SetMovieSubtitle(this, ActiveSubtitlesText);
+}
+
 void UMediaSubtitlesPlayer::Tick(float DeltaSeconds)
 {
     QUICK_SCOPE_CYCLE_COUNTER(STAT_UMediaSubtitlesPlayer_Tick);
@@ -52,17 +85,17 @@ void UMediaSubtitlesPlayer::Tick(float DeltaSeconds)
 		UMediaPlayer* MediaPlayerPtr = MediaPlayer.Get();
 		if (MediaPlayerPtr)
 		{
-			FTimespan CurrentTime = MediaPlayerPtr->GetTime();
-			TArray<FOverlayItem> CurrentSubtitles;
-			SourceSubtitles->GetOverlaysForTime(CurrentTime, CurrentSubtitles);
-
-			TArray<FString> SubtitlesText;
-			for (const FOverlayItem& Subtitle : CurrentSubtitles)
+			// SourceSubtitles can also be set directly from Blueprints
+			if (CueTimelineSource.Get() != SourceSubtitles)
 			{
-				SubtitlesText.Add(Subtitle.Text);
+				RebuildCueTimeline();
 			}
 
-			FSubtitleManager::GetSubtitleManager()->SetMovieSubtitle(this, SubtitlesText);
+			// Only tell the subtitle manager (and through it the display widgets) when the active cues change
+			if (CueTimeline.Advance(MediaPlayerPtr->GetTime()))
+			{
+				UpdateMovieSubtitle();
+			}
 		}
 		else
 		{
@@ -0,0 +1,110 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "SubtitleCueTimeline.h"
+
+void FSubtitleCueTimeline::SetCues(TArray<FSubtitleCue>&& InCues)
+{
+	Cues = MoveTemp(InCues);
+	Cues.RemoveAll([](const FSubtitleCue& Cue) { return Cue.EndTime <= Cue.StartTime; });
+	Cues.StableSort([](const FSubtitleCue& A, const FSubtitleCue& B) { return A.StartTime < B.StartTime; });
+
+	Rewind();
+}
+
+void FSubtitleCueTimeline::Empty()
+{
+	Cues.Empty();
+	ActiveRing.Empty();
+	Rewind();
+}
+
+void FSubtitleCueTimeline::Rewind()
+{
+	NextCueIndex = 0;
+	ActiveHead = 0;
+	NumActive = 0;
+	LastTime = FTimespan::MinValue();
+}
+
+bool FSubtitleCueTimeline::Advance(const FTimespan& Time)
+{
+	bool bChanged = false;
+
+	if (Time < LastTime)
+	{
+		bChanged = (NumActive > 0);
+		Rewind();
+	}
+	LastTime = Time;
+
+	// Expire from the front, the ring is sorted by end time
+	while ((NumActive > 0) && (Cues[GetActiveCueIndex(0)].EndTime <= Time))
+	{
+		ActiveHead = (ActiveHead + 1) & (ActiveRing.Num() - 1);
+		--NumActive;
+		bChanged = true;
+	}
+
+	// Admit everything that has started, skipping cues that were jumped over entirely
+	while ((NextCueIndex < Cues.Num()) && (Cues[NextCueIndex].StartTime <= Time))
+	{
+		if (Cues[NextCueIndex].EndTime > Time)
+		{
+			InsertActive(NextCueIndex);
+			bChanged = true;
+		}
+		++NextCueIndex;
+	}
+
+	return bChanged;
+}
+
+void FSubtitleCueTimeline::GetActiveText(TArray<FString>& OutText) const
+{
+	OutText.Reset();
+
+	// Cue indices follow start time order
+	TArray<int32, TInlineAllocator<8>> ActiveCueIndices;
+	for (int32 Offset = 0; Offset < NumActive; ++Offset)
+	{
+		ActiveCueIndices.Add(GetActiveCueIndex(Offset));
+	}
+	ActiveCueIndices.Sort();
+
+	for (int32 CueIndex : ActiveCueIndices)
+	{
+		OutText.Add(Cues[CueIndex].Text);
+	}
+}
+
+void FSubtitleCueTimeline::InsertActive(int32 CueIndex)
+{
+	if (NumActive == ActiveRing.Num())
+	{
+		GrowActive();
+	}
+
+	// Insertion sort from the back, cues usually end after the ones already on screen so this rarely moves anything
+	const FTimespan EndTime = Cues[CueIndex].EndTime;
+	int32 Offset = NumActive;
+	while ((Offset > 0) && (Cues[GetActiveCueIndex(Offset - 1)].EndTime > EndTime))
+	{
+		GetActiveCueIndex(Offset) = GetActiveCueIndex(Offset - 1);
+		--Offset;
+	}
+	GetActiveCueIndex(Offset) = CueIndex;
+	++NumActive;
+}
+
+void FSubtitleCueTimeline::GrowActive()
+{
+	TArray<int32> NewRing;
+	NewRing.SetNumUninitialized(FMath::Max(8, ActiveRing.Num() * 2));
+	for (int32 Offset = 0; Offset < NumActive; ++Offset)
+	{
+		NewRing[Offset] = GetActiveCueIndex(Offset);
+	}
+
+	ActiveRing = MoveTemp(NewRing);
+	ActiveHead = 0;
+}
@@ -0,0 +1,121 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "SubtitleCueTimeline.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSubtitleCueTimelineTest, "GameSubtitles.CueTimeline", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSubtitleCueTimelineTest::RunTest(const FString& Parameters)
+{
+	const int32 NumCues = 10000;
+	const double ScriptSeconds = 3600.0;
+	const int32 NumSteps = 20000;
+
+	// Dense, overlapping dialogue in a random order, plus a few cues that end before they start
+	TArray<FSubtitleCue> Script;
+	{
+		FRandomStream Random(0x5B7171E5);
+		Script.Reserve(NumCues);
+		for (int32 CueIndex = 0; CueIndex < NumCues; CueIndex++)
+		{
+			const double StartSeconds = Random.FRandRange(0.0f, (float)ScriptSeconds);
+			const double DurationSeconds = ((CueIndex % 100) == 0) ? -1.0 : Random.FRandRange(0.05f, 6.0f);
+
+			FSubtitleCue& Cue = Script.AddDefaulted_GetRef();
+			Cue.StartTime = FTimespan::FromSeconds(StartSeconds);
+			Cue.EndTime = FTimespan::FromSeconds(StartSeconds + DurationSeconds);
+			Cue.Text = FString::Printf(TEXT("Cue %d"), CueIndex);
+		}
+	}
+
+	// What the timeline should report, by scanning the whole script in start time order
+	TArray<FSubtitleCue> SortedScript = Script;
+	SortedScript.StableSort([](const FSubtitleCue& A, const FSubtitleCue& B) { return A.StartTime < B.StartTime; });
+
+	auto GetExpectedText = [&SortedScript](const FTimespan& Time, TArray<FString>& OutText)
+	{
+		OutText.Reset();
+		for (const FSubtitleCue& Cue : SortedScript)
+		{
+			if ((Cue.StartTime <= Time) && (Time < Cue.EndTime))
+			{
+				OutText.Add(Cue.Text);
+			}
+		}
+	};
+
+	FSubtitleCueTimeline Timeline;
+	Timeline.SetCues(CopyTemp(Script));
+	TestEqual(TEXT("Cues that end before they start are dropped"), Timeline.NumCues(), NumCues - (NumCues / 100));
+
+	TArray<FString> ActiveText;
+	TArray<FString> ExpectedText;
+
+	// Cues starting together show in script order
+	{
+		FSubtitleCueTimeline TiedTimeline;
+		TArray<FSubtitleCue> TiedCues;
+		for (int32 CueIndex = 0; CueIndex < 4; CueIndex++)
+		{
+			FSubtitleCue& Cue = TiedCues.AddDefaulted_GetRef();
+			Cue.StartTime = FTimespan::FromSeconds(1.0);
+			Cue.EndTime = FTimespan::FromSeconds((CueIndex == 1) ? 0.5 : 2.0);
+			Cue.Text = FString::Printf(TEXT("Tied %d"), CueIndex);
+		}
+		TiedTimeline.SetCues(MoveTemp(TiedCues));
+		TiedTimeline.Advance(FTimespan::FromSeconds(1.5));
+		TiedTimeline.GetActiveText(ActiveText);
+		TestTrue(TEXT("Dropping empty cues keeps the script order of cues with the same start time"), ActiveText == TArray<FString>({ TEXT("Tied 0"), TEXT("Tied 2"), TEXT("Tied 3") }));
+	}
+
+	// Play through at 60Hz-ish steps, jumping ahead now and then so some cues are skipped entirely
+	{
+		FRandomStream Random(0x0C0FFEE0);
+		int32 NumMismatches = 0;
+		int32 NumMissedChanges = 0;
+		double TimeSeconds = 0.0;
+
+		for (int32 StepIndex = 0; (StepIndex < NumSteps) && (TimeSeconds < ScriptSeconds); StepIndex++)
+		{
+			TimeSeconds += ((StepIndex % 500) == 499) ? Random.FRandRange(5.0f, 30.0f) : (1.0 / 60.0);
+			const FTimespan Time = FTimespan::FromSeconds(TimeSeconds);
+
+			TArray<FString> PreviousText = ActiveText;
+			const bool bChanged = Timeline.Advance(Time);
+
+			Timeline.GetActiveText(ActiveText);
+			GetExpectedText(Time, ExpectedText);
+
+			NumMismatches += (ActiveText != ExpectedText) ? 1 : 0;
+			NumMissedChanges += (!bChanged && (ActiveText != PreviousText)) ? 1 : 0;
+		}
+
+		TestEqual(TEXT("The active cues match a scan of the whole script at every step"), NumMismatches, 0);
+		TestEqual(TEXT("Advance reports every change of the active cues"), NumMissedChanges, 0);
+	}
+
+	// Seeking backwards rebuilds the active set
+	{
+		const FTimespan SeekTime = FTimespan::FromSeconds(ScriptSeconds * 0.25);
+		Timeline.Advance(SeekTime);
+		Timeline.GetActiveText(ActiveText);
+		GetExpectedText(SeekTime, ExpectedText);
+		TestTrue(TEXT("Seeking backwards matches a scan of the whole script"), ActiveText == ExpectedText);
+		TestEqual(TEXT("NumActiveCues matches the active text"), Timeline.NumActiveCues(), ActiveText.Num());
+	}
+
+	{
+		Timeline.Advance(FTimespan::FromSeconds(ScriptSeconds + 10.0));
+		TestEqual(TEXT("Nothing is active past the end of the script"), Timeline.NumActiveCues(), 0);
+
+		Timeline.Empty();
+		TestFalse(TEXT("An empty timeline never changes"), Timeline.Advance(FTimespan::FromSeconds(1.0)));
+	}
+
+	return true;
+}
+
+#endif
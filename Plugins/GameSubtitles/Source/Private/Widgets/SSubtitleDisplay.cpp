@@ -48,7 +48,13 @@ void SSubtitleDisplay::SetBackgroundBrush(const FSlateBrush* InSlateBrush)
 void SSubtitleDisplay::SetCurrentSubtitleText(const FText& InSubtitleText)
 {
 	Background->SetVisibility(InSubtitleText.IsEmpty() ? EVisibility::Collapsed : EVisibility::HitTestInvisible);
-	TextDisplay->SetText(InSubtitleText);
+
+	// Setting the text invalidates the rich text layout, skip it when the string is the same
+	if (!InSubtitleText.IdenticalTo(AppliedSubtitleText) && !InSubtitleText.ToString().Equals(AppliedSubtitleText.ToString(), ESearchCase::CaseSensitive))
+	{
+		AppliedSubtitleText = InSubtitleText;
+		TextDisplay->SetText(InSubtitleText);
+	}
 }
 
 bool SSubtitleDisplay::HasSubtitles() const
@@ -63,13 +69,26 @@ void SSubtitleDisplay::SetWrapTextAt(const TAttribute<float>& InWrapTextAt)
 
 void SSubtitleDisplay::HandleSubtitleChanged(const FText& InSubtitleText)
 {
+	PendingSubtitleText = InSubtitleText;
+
+	if (!PendingSubtitleTimerHandle.IsValid())
+	{
+		PendingSubtitleTimerHandle = RegisterActiveTimer(0.0f, FWidgetActiveTimerDelegate::CreateSP(this, &SSubtitleDisplay::ApplyPendingSubtitleText));
+	}
+}
+
+EActiveTimerReturnType SSubtitleDisplay::ApplyPendingSubtitleText(double InCurrentTime, float InDeltaTime)
+{
+	PendingSubtitleTimerHandle.Reset();
+
 	if (UGameplayStatics::AreSubtitlesEnabled())
 	{
-		Background->SetVisibility(InSubtitleText.IsEmpty() ? EVisibility::Collapsed : EVisibility::HitTestInvisible);
-		TextDisplay->SetText(InSubtitleText);
+		SetCurrentSubtitleText(PendingSubtitleText);
 	}
 	else
 	{
 		Background->SetVisibility(EVisibility::Collapsed);
 	}
+
+	return EActiveTimerReturnType::Stop;
 }
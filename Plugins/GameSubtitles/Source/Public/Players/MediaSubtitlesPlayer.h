@@ -10,6 +10,7 @@
 #include "Tickable.h"
 #include "Misc/Timespan.h"
 #include "IMediaPlayer.h"
+#include "SubtitleCueTimeline.h"
 
 #include "MediaSubtitlesPlayer.generated.h"
 
@@ -62,6 +63,23 @@ public:
 
 private:
 
+	/** Rebuilds CueTimeline from SourceSubtitles */
+	void RebuildCueTimeline();
+
+	/** Sends the active cues to the subtitle manager */
+	void UpdateMovieSubtitle();
+
+private:
+
+	/** The cues of SourceSubtitles, so each tick only looks at the cues that started or ended since the last one */
+	FSubtitleCueTimeline CueTimeline;
+
+	/** The subtitles CueTimeline was built from */
+	TWeakObjectPtr<UOverlays> CueTimelineSource;
+
+	/** Reused between ticks */
+	TArray<FString> ActiveSubtitlesText;
+
 	/** A reference to our media player */
 	TWeakObjectPtr<class UMediaPlayer> MediaPlayer;
 
@@ -0,0 +1,67 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Timespan.h"
+
+/** A single timed subtitle line */
+struct GAMESUBTITLES_API FSubtitleCue
+{
+	FTimespan StartTime;
+	FTimespan EndTime;
+	FString Text;
+};
+
+/**
+ * Tracks which cues of a subtitle script are active as playback time moves forward.
+ *
+ * Cues are kept sorted by start time and admitted through a cursor, active cues live in a ring buffer sorted
+ * by end time so expiring them is a pop from the front.  Advancing costs O(cues started or ended since the last
+ * call) instead of a scan of the whole script, which matters for dense dialogue with thousands of short cues.
+ * Seeking backwards rebuilds the active set from the start of the script.
+ *
+ * Has no UObject or viewport dependencies.
+ */
+class GAMESUBTITLES_API FSubtitleCueTimeline
+{
+public:
+	/** Replaces the script.  Cues can be in any order, cues that end before they start are dropped. */
+	void SetCues(TArray<FSubtitleCue>&& InCues);
+
+	/** Removes all cues */
+	void Empty();
+
+	/** Clears the active cues, the next Advance will evaluate from the start of the script */
+	void Rewind();
+
+	/** Moves playback to Time (a cue is active while StartTime <= Time < EndTime).  Returns true if the set of active cues changed. */
+	bool Advance(const FTimespan& Time);
+
+	/** Fills OutText with the text of the active cues, in start time order */
+	void GetActiveText(TArray<FString>& OutText) const;
+
+	int32 NumCues() const { return Cues.Num(); }
+	int32 NumActiveCues() const { return NumActive; }
+
+private:
+	void InsertActive(int32 CueIndex);
+	void GrowActive();
+
+	int32 GetActiveCueIndex(int32 Offset) const { return ActiveRing[(ActiveHead + Offset) & (ActiveRing.Num() - 1)]; }
+	int32& GetActiveCueIndex(int32 Offset) { return ActiveRing[(ActiveHead + Offset) & (ActiveRing.Num() - 1)]; }
+
+private:
+	/** All cues, sorted by start time */
+	TArray<FSubtitleCue> Cues;
+
+	/** The first cue that has not started yet */
+	int32 NextCueIndex = 0;
+
+	/** Indices into Cues of the active cues, sorted by end time.  The size is always a power of two. */
+	TArray<int32> ActiveRing;
+	int32 ActiveHead = 0;
+	int32 NumActive = 0;
+
+	FTimespan LastTime = FTimespan::MinValue();
+};
@@ -50,8 +50,19 @@ public:
 private:
 	void HandleSubtitleChanged(const FText& SubtitleText);
 
+	/** Applies the latest subtitle text received this frame */
+	EActiveTimerReturnType ApplyPendingSubtitleText(double InCurrentTime, float InDeltaTime);
+
 private:
 
+	/** The subtitle manager can broadcast several times per frame, only the last text is applied */
+	FText PendingSubtitleText;
+
+	TSharedPtr<FActiveTimerHandle> PendingSubtitleTimerHandle;
+
+	/** The text last given to TextDisplay, compared against without going through the rich text block */
+	FText AppliedSubtitleText;
+
 	TSharedPtr<class SBorder> Background;
 
 	/** The actual widget that will display the subtitle text */
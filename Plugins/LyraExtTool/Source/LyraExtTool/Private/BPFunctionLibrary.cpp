@@ -3,20 +3,57 @@
 #include "BPFunctionLibrary.h"
 #include "Engine/StaticMesh.h"
 #include "Materials/MaterialInterface.h"
+#include "StaticMeshResources.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogLyraExtTool, Log, All);
 
 bool UBPFunctionLibrary::ChangeMeshMaterials(TArray<UStaticMesh*> Mesh, UMaterialInterface* Material)
 {
+	ChangeMeshMaterialsBatched(Mesh, Material);
+	return true;
+}
 
-	for (int i = 0; i < Mesh.Num(); i++)
+int32 UBPFunctionLibrary::ChangeMeshMaterialsBatched(const TArray<UStaticMesh*>& Meshes, UMaterialInterface* Material)
+{
+	// Only touch meshes that have at least one slot using a different material
+	TArray<UStaticMesh*> MeshesToChange;
+	for (UStaticMesh* StaticMesh : Meshes)
 	{
-		Mesh[i]->Modify();
-		TArray<FStaticMaterial>& Mats = Mesh[i]->GetStaticMaterials();
-		for (int j = 0; j < Mats.Num(); j++)
+		if (StaticMesh == nullptr)
 		{
-			Mats[j].MaterialInterface = Material;
+			continue;
+		}
 
+		const bool bAlreadyMatches = !StaticMesh->GetStaticMaterials().ContainsByPredicate([Material](const FStaticMaterial& StaticMaterial) { return StaticMaterial.MaterialInterface != Material; });
+		if (!bAlreadyMatches)
+		{
+			MeshesToChange.AddUnique(StaticMesh);
 		}
-		Mesh[i]->PostEditChange();
 	}
-	return true;
-}
\ No newline at end of file
+
+	UE_LOG(LogLyraExtTool, Log, TEXT("ChangeMeshMaterials: changing %d mesh(es) to %s, %d already matched"), MeshesToChange.Num(), *GetNameSafe(Material), Meshes.Num() - MeshesToChange.Num());
+
+	if (MeshesToChange.Num() == 0)
+	{
+		return 0;
+	}
+
+	{
+		// Calling PostEditChange on each mesh rebuilds it and recreates the render state of every component using it,
+		// one mesh at a time.  Instead tear the render state down once for all of them and rebuild them together.
+		FStaticMeshComponentRecreateRenderStateContext RecreateRenderStateContext(MeshesToChange, /*bUnbuildLighting=*/ false);
+
+		for (UStaticMesh* StaticMesh : MeshesToChange)
+		{
+			StaticMesh->Modify();
+			for (FStaticMaterial& StaticMaterial : StaticMesh->GetStaticMaterials())
+			{
+				StaticMaterial.MaterialInterface = Material;
+			}
+		}
+
+		UStaticMesh::BatchBuild(MeshesToChange);
+	}
+
+	return MeshesToChange.Num();
+}
@@ -0,0 +1,122 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ChangeMeshMaterialsCommandlet.h"
+#include "BPFunctionLibrary.h"
+#include "AssetRegistryModule.h"
+#include "ARFilter.h"
+#include "Engine/StaticMesh.h"
+#include "Materials/MaterialInterface.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#include "HAL/FileManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogLyraChangeMeshMaterials, Log, All);
+
+namespace LyraChangeMeshMaterials
+{
+	// Meshes are loaded, changed and saved this many at a time, so a huge folder doesn't all have to fit in memory
+	static const int32 MeshesPerBatch = 200;
+}
+
+UChangeMeshMaterialsCommandlet::UChangeMeshMaterialsCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UChangeMeshMaterialsCommandlet::Main(const FString& FullCommandLine)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> Params;
+	ParseCommandLine(*FullCommandLine, Tokens, Switches, Params);
+
+	const FString* ContentPath = Params.Find(TEXT("Path"));
+	const FString* MaterialPath = Params.Find(TEXT("Material"));
+	if ((ContentPath == nullptr) || (MaterialPath == nullptr))
+	{
+		UE_LOG(LogLyraChangeMeshMaterials, Error, TEXT("Usage: -run=ChangeMeshMaterials -Path=/Game/Some/Folder -Material=/Game/Some/M_Material.M_Material [-NoSave]"));
+		return 1;
+	}
+
+	const bool bSave = !Switches.Contains(TEXT("NoSave"));
+
+	UMaterialInterface* Material = LoadObject<UMaterialInterface>(nullptr, **MaterialPath);
+	if (Material == nullptr)
+	{
+		UE_LOG(LogLyraChangeMeshMaterials, Error, TEXT("Could not load material '%s'"), **MaterialPath);
+		return 1;
+	}
+
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	FARFilter Filter;
+	Filter.PackagePaths.Add(FName(**ContentPath));
+	Filter.bRecursivePaths = true;
+	Filter.ClassNames.Add(UStaticMesh::StaticClass()->GetFName());
+
+	TArray<FAssetData> MeshAssets;
+	AssetRegistry.GetAssets(Filter, MeshAssets);
+
+	UE_LOG(LogLyraChangeMeshMaterials, Display, TEXT("Found %d static mesh(es) under %s"), MeshAssets.Num(), **ContentPath);
+
+	int32 NumChanged = 0;
+	int32 NumFailedToSave = 0;
+
+	for (int32 BatchStart = 0; BatchStart < MeshAssets.Num(); BatchStart += LyraChangeMeshMaterials::MeshesPerBatch)
+	{
+		const int32 BatchEnd = FMath::Min(BatchStart + LyraChangeMeshMaterials::MeshesPerBatch, MeshAssets.Num());
+
+		TArray<UStaticMesh*> Meshes;
+		for (int32 AssetIndex = BatchStart; AssetIndex < BatchEnd; ++AssetIndex)
+		{
+			if (UStaticMesh* StaticMesh = Cast<UStaticMesh>(MeshAssets[AssetIndex].GetAsset()))
+			{
+				Meshes.Add(StaticMesh);
+			}
+		}
+
+		NumChanged += UBPFunctionLibrary::ChangeMeshMaterialsBatched(Meshes, Material);
+
+		if (bSave)
+		{
+			for (UStaticMesh* StaticMesh : Meshes)
+			{
+				UPackage* Package = StaticMesh->GetOutermost();
+				if (!Package->IsDirty())
+				{
+					continue;
+				}
+
+				const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+				if (IFileManager::Get().IsReadOnly(*Filename))
+				{
+					UE_LOG(LogLyraChangeMeshMaterials, Error, TEXT("Cannot save %s, the file is read only (check it out first)"), *Filename);
+					++NumFailedToSave;
+					continue;
+				}
+
+				FSavePackageArgs SaveArgs;
+				SaveArgs.TopLevelFlags = RF_Standalone;
+				if (!UPackage::SavePackage(Package, nullptr, *Filename, SaveArgs))
+				{
+					UE_LOG(LogLyraChangeMeshMaterials, Error, TEXT("Failed to save %s"), *Filename);
+					++NumFailedToSave;
+				}
+			}
+		}
+
+		UE_LOG(LogLyraChangeMeshMaterials, Display, TEXT("Processed %d/%d meshes"), BatchEnd, MeshAssets.Num());
+
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	UE_LOG(LogLyraChangeMeshMaterials, Display, TEXT("Changed %d of %d mesh(es) to %s%s"), NumChanged, MeshAssets.Num(), *Material->GetPathName(), bSave ? TEXT("") : TEXT(" (not saved)"));
+
+	return (NumFailedToSave > 0) ? 1 : 0;
+}
@@ -17,4 +17,8 @@ class UBPFunctionLibrary : public UBlueprintFunctionLibrary
 
     UFUNCTION(BlueprintCallable, Category="LyraExt")
     static bool ChangeMeshMaterials(TArray<UStaticMesh*> Mesh, UMaterialInterface* Material);
-};
\ No newline at end of file
+
+public:
+    /** Sets every material slot of the meshes to Material, skipping meshes that already match and rebuilding the rest in one batch. Returns the number of meshes changed. */
+    static int32 ChangeMeshMaterialsBatched(const TArray<UStaticMesh*>& Meshes, UMaterialInterface* Material);
+};
@@ -0,0 +1,25 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ChangeMeshMaterialsCommandlet.generated.h"
+
+/**
+ * Sets every material slot of the static meshes under a content folder to one material, and saves the meshes that changed.
+ *
+ * Usage: -run=ChangeMeshMaterials -Path=/Game/Some/Folder -Material=/Game/Some/M_Material.M_Material [-NoSave] -nullrhi
+ */
+UCLASS()
+class UChangeMeshMaterialsCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UChangeMeshMaterialsCommandlet();
+
+	// Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	// End UCommandlet Interface
+};
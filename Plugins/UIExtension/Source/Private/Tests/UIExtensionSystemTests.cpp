@@ -0,0 +1,175 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UIExtensionSystem.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "NativeGameplayTags.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_UIExtensionTest, "UIExtensionTest");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_UIExtensionTest_A, "UIExtensionTest.A");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_UIExtensionTest_A_Child, "UIExtensionTest.A.Child");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_UIExtensionTest_A_Child_Leaf, "UIExtensionTest.A.Child.Leaf");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_UIExtensionTest_B, "UIExtensionTest.B");
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUIExtensionBucketsTest, "UIExtension.Subsystem.Buckets", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FUIExtensionBucketsTest::RunTest(const FString& Parameters)
+{
+	const int32 NumExtensions = 5000;
+	const int32 NumContextObjects = 10;
+
+	struct FTestPoint
+	{
+		FGameplayTag Tag;
+		UObject* ContextObject = nullptr;
+		EUIExtensionPointMatch MatchType = EUIExtensionPointMatch::ExactMatch;
+		FUIExtensionPointHandle Handle;
+
+		/** What the point was told about, added minus removed */
+		TSet<FUIExtensionHandle> KnownExtensions;
+		int32 NumBadRemovals = 0;
+	};
+
+	struct FTestExtension
+	{
+		FGameplayTag Tag;
+		UObject* ContextObject = nullptr;
+		bool bAllowedData = false;
+		FUIExtensionHandle Handle;
+	};
+
+	// What the subsystem used to compute by visiting every extension point for every extension
+	auto ShouldPointKnowExtension = [](const FTestPoint& Point, const FTestExtension& Extension)
+	{
+		const bool bTagMatches = (Point.MatchType == EUIExtensionPointMatch::ExactMatch) ? (Extension.Tag == Point.Tag) : Extension.Tag.MatchesTag(Point.Tag);
+		return bTagMatches && (Extension.ContextObject == Point.ContextObject) && Extension.bAllowedData;
+	};
+
+	UUIExtensionSubsystem* Subsystem = NewObject<UUIExtensionSubsystem>();
+
+	const FGameplayTag Tags[] = { TAG_UIExtensionTest, TAG_UIExtensionTest_A, TAG_UIExtensionTest_A_Child, TAG_UIExtensionTest_A_Child_Leaf, TAG_UIExtensionTest_B };
+
+	// Extensions registered without a context go to points without a context, so null is one of the contexts
+	TArray<UObject*> ContextObjects = { nullptr };
+	for (int32 ContextIndex = 0; ContextIndex < NumContextObjects; ContextIndex++)
+	{
+		ContextObjects.Add(NewObject<UUIExtensionHandleFunctions>(GetTransientPackage()));
+	}
+
+	// Data can be given as a class, only function libraries are allowed so the subsystem class exercises the contract
+	UClass* AllowedDataClass = UUIExtensionHandleFunctions::StaticClass();
+	UClass* RejectedDataClass = UUIExtensionSubsystem::StaticClass();
+	const TArray<UClass*> AllowedDataClasses = { UBlueprintFunctionLibrary::StaticClass() };
+
+	TArray<FTestPoint> Points;
+	Points.Reserve(UE_ARRAY_COUNT(Tags) * ContextObjects.Num() * 2);
+	TArray<FTestExtension> Extensions;
+	Extensions.Reserve(NumExtensions);
+
+	FRandomStream Random(0x0E87E510);
+
+	auto RegisterExtensions = [&](int32 Count)
+	{
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			FTestExtension& Extension = Extensions.AddDefaulted_GetRef();
+			Extension.Tag = Tags[Random.RandHelper(UE_ARRAY_COUNT(Tags))];
+			Extension.ContextObject = ContextObjects[Random.RandHelper(ContextObjects.Num())];
+			Extension.bAllowedData = (Random.RandHelper(10) != 0);
+			Extension.Handle = Subsystem->RegisterExtensionAsData(Extension.Tag, Extension.ContextObject, Extension.bAllowedData ? AllowedDataClass : RejectedDataClass, Index);
+		}
+	};
+
+	// Half the extensions exist before the points, so both notification directions are covered
+	RegisterExtensions(NumExtensions / 2);
+
+	for (const FGameplayTag& Tag : Tags)
+	{
+		for (UObject* ContextObject : ContextObjects)
+		{
+			for (EUIExtensionPointMatch MatchType : { EUIExtensionPointMatch::ExactMatch, EUIExtensionPointMatch::PartialMatch })
+			{
+				const int32 PointIndex = Points.AddDefaulted();
+				FTestPoint& Point = Points[PointIndex];
+				Point.Tag = Tag;
+				Point.ContextObject = ContextObject;
+				Point.MatchType = MatchType;
+
+				TArray<FTestPoint>* PointsPtr = &Points;
+				Point.Handle = Subsystem->RegisterExtensionPointForContext(Tag, ContextObject, MatchType, AllowedDataClasses, FExtendExtensionPointDelegate::CreateLambda([PointsPtr, PointIndex](EUIExtensionAction Action, const FUIExtensionRequest& Request) {
+					FTestPoint& NotifiedPoint = (*PointsPtr)[PointIndex];
+					if (Action == EUIExtensionAction::Added)
+					{
+						NotifiedPoint.KnownExtensions.Add(Request.ExtensionHandle);
+					}
+					else if (NotifiedPoint.KnownExtensions.Remove(Request.ExtensionHandle) == 0)
+					{
+						NotifiedPoint.NumBadRemovals++;
+					}
+				}));
+			}
+		}
+	}
+
+	RegisterExtensions(NumExtensions - Extensions.Num());
+
+	// Remove every third extension
+	TArray<FTestExtension> LiveExtensions;
+	for (int32 Index = 0; Index < Extensions.Num(); Index++)
+	{
+		if ((Index % 3) == 0)
+		{
+			Subsystem->UnregisterExtension(Extensions[Index].Handle);
+		}
+		else
+		{
+			LiveExtensions.Add(Extensions[Index]);
+		}
+	}
+
+	int32 NumWrongPoints = 0;
+	int32 NumBadRemovals = 0;
+	for (const FTestPoint& Point : Points)
+	{
+		TSet<FUIExtensionHandle> ExpectedExtensions;
+		for (const FTestExtension& Extension : LiveExtensions)
+		{
+			if (ShouldPointKnowExtension(Point, Extension))
+			{
+				ExpectedExtensions.Add(Extension.Handle);
+			}
+		}
+
+		const bool bMatches = (ExpectedExtensions.Num() == Point.KnownExtensions.Num()) && (ExpectedExtensions.Difference(Point.KnownExtensions).Num() == 0);
+		NumWrongPoints += bMatches ? 0 : 1;
+		NumBadRemovals += Point.NumBadRemovals;
+	}
+
+	TestEqual(TEXT("Every point knows exactly the extensions that match its tag, context and data classes"), NumWrongPoints, 0);
+	TestEqual(TEXT("Points are only told about the removal of extensions they knew"), NumBadRemovals, 0);
+
+	// Unregistered points stop hearing about extensions
+	for (FTestPoint& Point : Points)
+	{
+		Subsystem->UnregisterExtensionPoint(Point.Handle);
+		Point.KnownExtensions.Reset();
+	}
+
+	for (const FTestExtension& Extension : LiveExtensions)
+	{
+		Subsystem->UnregisterExtension(Extension.Handle);
+	}
+
+	int32 NumNotifiedAfterUnregister = 0;
+	for (const FTestPoint& Point : Points)
+	{
+		NumNotifiedAfterUnregister += Point.NumBadRemovals;
+	}
+	TestEqual(TEXT("Unregistered points are not notified"), NumNotifiedAfterUnregister, NumBadRemovals);
+
+	return true;
+}
+
+#endif
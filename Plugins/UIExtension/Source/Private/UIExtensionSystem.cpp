@@ -115,15 +115,22 @@ FUIExtensionPointHandle UUIExtensionSubsystem::RegisterExtensionPointForContext(
 		return FUIExtensionPointHandle();
 	}
 
-	FExtensionPointList& List = ExtensionPointMap.FindOrAdd(ExtensionPointTag);
+	const FExtensionBucketKey BucketKey(ExtensionPointTag, FObjectKey(ContextObject));
+	FExtensionPointList& List = ExtensionPointMap.FindOrAdd(BucketKey);
 
 	TSharedPtr<FUIExtensionPoint>& Entry = List.Add_GetRef(MakeShared<FUIExtensionPoint>());
 	Entry->ExtensionPointTag = ExtensionPointTag;
 	Entry->ContextObject = ContextObject;
+	Entry->ContextObjectKey = BucketKey.Value;
 	Entry->ExtensionPointTagMatchType = ExtensionPointTagMatchType;
 	Entry->AllowedDataClasses = AllowedDataClasses;
 	Entry->Callback = MoveTemp(ExtensionCallback);
 
+	if (ExtensionPointTagMatchType == EUIExtensionPointMatch::PartialMatch)
+	{
+		PartialMatchExtensionPointMap.FindOrAdd(BucketKey).Add(Entry);
+	}
+
 	UE_LOG(LogUIExtension, Verbose, TEXT("Extension Point [%s] Registered"), *ExtensionPointTag.ToString());
 
 	NotifyExtensionPointOfExtensions(Entry);
@@ -155,11 +162,13 @@ FUIExtensionHandle UUIExtensionSubsystem::RegisterExtensionAsData(const FGamepla
 		return FUIExtensionHandle();
 	}
 
-	FExtensionList& List = ExtensionMap.FindOrAdd(ExtensionPointTag);
+	const FExtensionBucketKey BucketKey(ExtensionPointTag, FObjectKey(ContextObject));
+	FExtensionList& List = ExtensionMap.FindOrAdd(BucketKey);
 
 	TSharedPtr<FUIExtension>& Entry = List.Add_GetRef(MakeShared<FUIExtension>());
 	Entry->ExtensionPointTag = ExtensionPointTag;
 	Entry->ContextObject = ContextObject;
+	Entry->ContextObjectKey = BucketKey.Value;
 	Entry->Data = Data;
 	Entry->Priority = Priority;
 
@@ -177,56 +186,81 @@ FUIExtensionHandle UUIExtensionSubsystem::RegisterExtensionAsData(const FGamepla
 	return FUIExtensionHandle(this, Entry);
 }
 
+const TArray<FGameplayTag>& UUIExtensionSubsystem::GetTagParentChain(const FGameplayTag& Tag)
+{
+	if (const TArray<FGameplayTag>* ChainPtr = TagParentChainCache.Find(Tag))
+	{
+		return *ChainPtr;
+	}
+
+	// A tag's parents are derived from its name, so the chain never needs to be invalidated
+	TArray<FGameplayTag>& Chain = TagParentChainCache.Add(Tag);
+	for (FGameplayTag ParentTag = Tag; ParentTag.IsValid(); ParentTag = ParentTag.RequestDirectParent())
+	{
+		Chain.Add(ParentTag);
+	}
+	return Chain;
+}
+
 void UUIExtensionSubsystem::NotifyExtensionPointOfExtensions(TSharedPtr<FUIExtensionPoint>& ExtensionPoint)
 {
-	for (FGameplayTag Tag = ExtensionPoint->ExtensionPointTag; Tag.IsValid(); Tag = Tag.RequestDirectParent())
+	// Copy since callbacks can register new tags
+	const TArray<FGameplayTag, TInlineAllocator<8>> TagChain(GetTagParentChain(ExtensionPoint->ExtensionPointTag));
+	const int32 NumTagsToCheck = (ExtensionPoint->ExtensionPointTagMatchType == EUIExtensionPointMatch::ExactMatch) ? 1 : TagChain.Num();
+
+	// Gather first, in case there are removals while handling callbacks
+	FExtensionList MatchingExtensions;
+	for (int32 TagIndex = 0; TagIndex < NumTagsToCheck; ++TagIndex)
 	{
-		if (const FExtensionList* ListPtr = ExtensionMap.Find(Tag))
+		if (const FExtensionList* ListPtr = ExtensionMap.Find(FExtensionBucketKey(TagChain[TagIndex], ExtensionPoint->ContextObjectKey)))
 		{
-			// Copy in case there are removals while handling callbacks
-			FExtensionList ExtensionArray(*ListPtr);
-
-			for (const TSharedPtr<FUIExtension>& Extension : ExtensionArray)
+			for (const TSharedPtr<FUIExtension>& Extension : *ListPtr)
 			{
 				if (ExtensionPoint->DoesExtensionPassContract(Extension.Get()))
 				{
-					FUIExtensionRequest Request = CreateExtensionRequest(Extension);
-					ExtensionPoint->Callback.ExecuteIfBound(EUIExtensionAction::Added, Request);
+					MatchingExtensions.Add(Extension);
 				}
 			}
 		}
+	}
 
-		if (ExtensionPoint->ExtensionPointTagMatchType == EUIExtensionPointMatch::ExactMatch)
-		{
-			break;
-		}
+	for (const TSharedPtr<FUIExtension>& Extension : MatchingExtensions)
+	{
+		FUIExtensionRequest Request = CreateExtensionRequest(Extension);
+		ExtensionPoint->Callback.ExecuteIfBound(EUIExtensionAction::Added, Request);
 	}
 }
 
 void UUIExtensionSubsystem::NotifyExtensionPointsOfExtension(EUIExtensionAction Action, TSharedPtr<FUIExtension>& Extension)
 {
-	bool bOnInitialTag = true;
-	for (FGameplayTag Tag = Extension->ExtensionPointTag; Tag.IsValid(); Tag = Tag.RequestDirectParent())
+	// Copy since callbacks can register new tags
+	const TArray<FGameplayTag, TInlineAllocator<8>> TagChain(GetTagParentChain(Extension->ExtensionPointTag));
+
+	// Gather first, in case there are removals while handling callbacks
+	FExtensionPointList MatchingExtensionPoints;
+	for (int32 TagIndex = 0; TagIndex < TagChain.Num(); ++TagIndex)
 	{
-		if (const FExtensionPointList* ListPtr = ExtensionPointMap.Find(Tag))
+		// Every point on the extension's own tag is interested, only partial match points are on its parents
+		const TMap<FExtensionBucketKey, FExtensionPointList>& PointMap = (TagIndex == 0) ? ExtensionPointMap : PartialMatchExtensionPointMap;
+		if (const FExtensionPointList* ListPtr = PointMap.Find(FExtensionBucketKey(TagChain[TagIndex], Extension->ContextObjectKey)))
 		{
-			// Copy in case there are removals while handling callbacks
-			FExtensionPointList ExtensionPointArray(*ListPtr);
-
-			for (const TSharedPtr<FUIExtensionPoint>& ExtensionPoint : ExtensionPointArray)
+			for (const TSharedPtr<FUIExtensionPoint>& ExtensionPoint : *ListPtr)
 			{
-				if (bOnInitialTag || (ExtensionPoint->ExtensionPointTagMatchType == EUIExtensionPointMatch::PartialMatch))
+				if (ExtensionPoint->DoesExtensionPassContract(Extension.Get()))
 				{
-					if (ExtensionPoint->DoesExtensionPassContract(Extension.Get()))
-					{
-						FUIExtensionRequest Request = CreateExtensionRequest(Extension);
-						ExtensionPoint->Callback.ExecuteIfBound(Action, Request);
-					}
+					MatchingExtensionPoints.Add(ExtensionPoint);
 				}
 			}
 		}
-		
-		bOnInitialTag = false;
+	}
+
+	if (MatchingExtensionPoints.Num() > 0)
+	{
+		FUIExtensionRequest Request = CreateExtensionRequest(Extension);
+		for (const TSharedPtr<FUIExtensionPoint>& ExtensionPoint : MatchingExtensionPoints)
+		{
+			ExtensionPoint->Callback.ExecuteIfBound(Action, Request);
+		}
 	}
 }
 
@@ -237,7 +271,8 @@ void UUIExtensionSubsystem::UnregisterExtension(const FUIExtensionHandle& Extens
 		checkf(ExtensionHandle.ExtensionSource == this, TEXT("Trying to unregister an extension that's not from this extension subsystem."));
 
 		TSharedPtr<FUIExtension> Extension = ExtensionHandle.DataPtr;
-		if (FExtensionList* ListPtr = ExtensionMap.Find(Extension->ExtensionPointTag))
+		const FExtensionBucketKey BucketKey(Extension->ExtensionPointTag, Extension->ContextObjectKey);
+		if (FExtensionList* ListPtr = ExtensionMap.Find(BucketKey))
 		{
 			if (Extension->ContextObject.IsExplicitlyNull())
 			{
@@ -250,11 +285,16 @@ void UUIExtensionSubsystem::UnregisterExtension(const FUIExtensionHandle& Extens
 
 			NotifyExtensionPointsOfExtension(EUIExtensionAction::Removed, Extension);
 
-			ListPtr->RemoveSwap(Extension);
-			
-			if (ListPtr->Num() == 0)
+			// The callbacks may have changed the map
+			ListPtr = ExtensionMap.Find(BucketKey);
+			if (ListPtr)
 			{
-				ExtensionMap.Remove(Extension->ExtensionPointTag);
+				ListPtr->RemoveSwap(Extension);
+
+				if (ListPtr->Num() == 0)
+				{
+					ExtensionMap.Remove(BucketKey);
+				}
 			}
 		}
 	}
@@ -271,14 +311,24 @@ void UUIExtensionSubsystem::UnregisterExtensionPoint(const FUIExtensionPointHand
 		check(ExtensionPointHandle.ExtensionSource == this);
 
 		const TSharedPtr<FUIExtensionPoint> ExtensionPoint = ExtensionPointHandle.DataPtr;
-		if (FExtensionPointList* ListPtr = ExtensionPointMap.Find(ExtensionPoint->ExtensionPointTag))
+		const FExtensionBucketKey BucketKey(ExtensionPoint->ExtensionPointTag, ExtensionPoint->ContextObjectKey);
+		if (FExtensionPointList* ListPtr = ExtensionPointMap.Find(BucketKey))
 		{
 			UE_LOG(LogUIExtension, Verbose, TEXT("Extension Point [%s] Unregistered"), *ExtensionPoint->ExtensionPointTag.ToString());
 
 			ListPtr->RemoveSwap(ExtensionPoint);
 			if (ListPtr->Num() == 0)
 			{
-				ExtensionPointMap.Remove(ExtensionPoint->ExtensionPointTag);
+				ExtensionPointMap.Remove(BucketKey);
+			}
+
+			if (FExtensionPointList* PartialListPtr = PartialMatchExtensionPointMap.Find(BucketKey))
+			{
+				PartialListPtr->RemoveSwap(ExtensionPoint);
+				if (PartialListPtr->Num() == 0)
+				{
+					PartialMatchExtensionPointMap.Remove(BucketKey);
+				}
 			}
 		}
 	}
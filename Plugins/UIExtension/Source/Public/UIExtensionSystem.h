@@ -5,6 +5,7 @@
 #include "UObject/SoftObjectPtr.h"
 #include "UObject/StrongObjectPtr.h"
 #include "UObject/WeakInterfacePtr.h"
+#include "UObject/ObjectKey.h"
 #include "UObject/Interface.h"
 #include "GameplayTagContainer.h"
 #include "Templates/SubclassOf.h"
@@ -54,6 +55,7 @@ struct FUIExtensionPoint : TSharedFromThis<FUIExtensionPoint>
 public:
 	FGameplayTag ExtensionPointTag;
 	TWeakObjectPtr<UObject> ContextObject;
+	FObjectKey ContextObjectKey;
 	EUIExtensionPointMatch ExtensionPointTagMatchType = EUIExtensionPointMatch::ExactMatch;
 	TArray<UClass*> AllowedDataClasses;
 	FExtendExtensionPointDelegate Callback;
@@ -116,6 +118,7 @@ public:
 	FGameplayTag ExtensionPointTag;
 	int32 Priority = INDEX_NONE;
 	TWeakObjectPtr<UObject> ContextObject;
+	FObjectKey ContextObjectKey;
 	//Kept alive by UUIExtensionSubsystem::AddReferencedObjects
 	UObject* Data = nullptr;
 };
@@ -249,11 +252,22 @@ protected:
 	FUIExtensionRequest CreateExtensionRequest(const TSharedPtr<FUIExtension>& Extension);
 
 private:
+	// Returns the tag followed by all of its parents, cached since the HUD registers the same handful of tags over and over
+	const TArray<FGameplayTag>& GetTagParentChain(const FGameplayTag& Tag);
+
+	// Extensions and extension points are bucketed by tag and context object, so only candidates that can match are visited
+	typedef TPair<FGameplayTag, FObjectKey> FExtensionBucketKey;
+
 	typedef TArray<TSharedPtr<FUIExtensionPoint>> FExtensionPointList;
-	TMap<FGameplayTag, FExtensionPointList> ExtensionPointMap;
+	TMap<FExtensionBucketKey, FExtensionPointList> ExtensionPointMap;
+
+	// Subset of ExtensionPointMap containing only the PartialMatch points, looked up for the parents of an extension's tag
+	TMap<FExtensionBucketKey, FExtensionPointList> PartialMatchExtensionPointMap;
 
 	typedef TArray<TSharedPtr<FUIExtension>> FExtensionList;
-	TMap<FGameplayTag, FExtensionList> ExtensionMap;
+	TMap<FExtensionBucketKey, FExtensionList> ExtensionMap;
+
+	TMap<FGameplayTag, TArray<FGameplayTag>> TagParentChainCache;
 };
 
 
@@ -142,3 +142,30 @@ void ULyraAbilitySet::GiveToAbilitySystem(ULyraAbilitySystemComponent* LyraASC,
 		}
 	}
 }
+
+void ULyraAbilitySet::GetGrantedClasses(TArray<UClass*>& OutClasses) const
+{
+	for (const FLyraAbilitySet_GameplayAbility& AbilityToGrant : GrantedGameplayAbilities)
+	{
+		if (AbilityToGrant.Ability)
+		{
+			OutClasses.AddUnique(AbilityToGrant.Ability);
+		}
+	}
+
+	for (const FLyraAbilitySet_GameplayEffect& EffectToGrant : GrantedGameplayEffects)
+	{
+		if (EffectToGrant.GameplayEffect)
+		{
+			OutClasses.AddUnique(EffectToGrant.GameplayEffect);
+		}
+	}
+
+	for (const FLyraAbilitySet_AttributeSet& SetToGrant : GrantedAttributes)
+	{
+		if (SetToGrant.AttributeSet)
+		{
+			OutClasses.AddUnique(SetToGrant.AttributeSet);
+		}
+	}
+}
@@ -132,6 +132,9 @@ public:
 	// The returned handles can be used later to take away anything that was granted.
 	void GiveToAbilitySystem(ULyraAbilitySystemComponent* LyraASC, FLyraAbilitySet_GrantedHandles* OutGrantedHandles, UObject* SourceObject = nullptr) const;
 
+	// Gathers the ability, effect and attribute set classes granted by this set (e.g., to warm them up before they are first granted).
+	void GetGrantedClasses(TArray<UClass*>& OutClasses) const;
+
 protected:
 
 	// Gameplay abilities to grant when this ability set is granted.
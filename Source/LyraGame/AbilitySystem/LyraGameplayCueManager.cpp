@@ -9,6 +9,9 @@
 #include "UObject/UObjectThreadContext.h"
 #include "System/LyraAssetManager.h"
 #include "Async/Async.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "AssetRegistry/AssetData.h"
+#include "Misc/PackageName.h"
 
 //////////////////////////////////////////////////////////////////////
 
@@ -34,10 +37,71 @@ namespace LyraGameplayCueManagerCvars
 		FConsoleCommandWithArgsDelegate::CreateStatic(ULyraGameplayCueManager::DumpGameplayCues));
 
 	static ELyraEditorLoadMode LoadMode = ELyraEditorLoadMode::LoadUpfront;
+
+	// Lyra.DumpGameplayCues reports the peak number of preloaded cues and their estimated size to tune these from
+	static int32 MaxPreloadedCues = 256;
+	static FAutoConsoleVariableRef CVarMaxPreloadedCues(
+		TEXT("Lyra.GameplayCues.MaxPreloadedCues"),
+		MaxPreloadedCues,
+		TEXT("Maximum number of content referenced cues to keep preloaded, the least recently invoked ones are released first (0 = unlimited). Always loaded cues are not counted."),
+		ECVF_Default);
+
+	static int32 MaxPreloadedCueMemoryKB = 64 * 1024;
+	static FAutoConsoleVariableRef CVarMaxPreloadedCueMemoryKB(
+		TEXT("Lyra.GameplayCues.MaxPreloadedCueMemoryKB"),
+		MaxPreloadedCueMemoryKB,
+		TEXT("Estimated size (in KB) of content referenced cues and the packages they hard reference that is allowed to stay loaded, the least recently invoked cues are released first (0 = unlimited)."),
+		ECVF_Default);
+
+	static int32 MaxAsyncLoadsPerFrame = 8;
+	static FAutoConsoleVariableRef CVarMaxAsyncLoadsPerFrame(
+		TEXT("Lyra.GameplayCues.MaxAsyncLoadsPerFrame"),
+		MaxAsyncLoadsPerFrame,
+		TEXT("Maximum number of cue preloads to start each frame, the rest are queued (0 = unlimited)."),
+		ECVF_Default);
 }
 
 const bool bPreloadEvenInEditor = true;
 
+namespace LyraGameplayCueManager
+{
+	// Estimates the memory of a cue from the size of its package and of every package it hard references (particle systems,
+	// sounds, meshes, ...). Only reads the asset registry, so it runs on a worker thread instead of walking the loaded objects.
+	// Packages shared between cues are counted for each of them, so this is an upper bound of what evicting the cue frees.
+	static SIZE_T EstimateCueMemory(const IAssetRegistry& AssetRegistry, FName CuePackageName)
+	{
+		SIZE_T TotalSize = 0;
+
+		TArray<FName> PendingPackages = { CuePackageName };
+		TSet<FName> VisitedPackages(PendingPackages);
+		TArray<FName> Dependencies;
+
+		while (PendingPackages.Num() > 0)
+		{
+			const FName PackageName = PendingPackages.Pop(/*bAllowShrinking=*/ false);
+			if (const TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(PackageName))
+			{
+				TotalSize += (SIZE_T)FMath::Max<int64>(PackageData->DiskSize, 0);
+			}
+
+			Dependencies.Reset();
+			AssetRegistry.GetDependencies(PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+
+			for (const FName Dependency : Dependencies)
+			{
+				// Script packages are always loaded, they don't count against the cue
+				if (!VisitedPackages.Contains(Dependency) && !FPackageName::IsScriptPackage(Dependency.ToString()))
+				{
+					VisitedPackages.Add(Dependency);
+					PendingPackages.Add(Dependency);
+				}
+			}
+		}
+
+		return TotalSize;
+	}
+}
+
 //////////////////////////////////////////////////////////////////////
 
 struct FGameplayCueTagThreadSynchronizeGraphTask : public FAsyncGraphTaskBase
@@ -122,6 +186,40 @@ bool ULyraGameplayCueManager::ShouldAsyncLoadMissingGameplayCues() const
 	return true;
 }
 
+void ULyraGameplayCueManager::HandleGameplayCue(AActor* TargetActor, FGameplayTag GameplayCueTag, EGameplayCueEvent::Type EventType, const FGameplayCueParameters& Parameters, EGameplayCueExecutionOptions Options)
+{
+	// Track whether the cue was ready to play and when it was last used, so the least recently used preloads can be released
+	if (ShouldDelayLoadGameplayCues() && (EventType != EGameplayCueEvent::Removed) && RuntimeGameplayCueObjectLibrary.CueSet)
+	{
+		if (const int32* DataIdx = RuntimeGameplayCueObjectLibrary.CueSet->GameplayCueDataMap.Find(GameplayCueTag))
+		{
+			const FGameplayCueNotifyData& CueData = RuntimeGameplayCueObjectLibrary.CueSet->GameplayCueData[*DataIdx];
+			// Adding a cue sends both OnActive and WhileActive, only count OnActive (and executions) as an invocation
+			const bool bIsInvocation = (EventType == EGameplayCueEvent::OnActive) || (EventType == EGameplayCueEvent::Executed);
+			if (UClass* CueClass = CueData.LoadedGameplayCueClass)
+			{
+				NumCueInvocationHits += bIsInvocation ? 1 : 0;
+				if (FPreloadedCueUsage* Usage = PreloadedCueUsage.Find(CueClass))
+				{
+					Usage->LastUseTime = FPlatformTime::Seconds();
+				}
+			}
+			else
+			{
+				NumLateLoadedCues += bIsInvocation ? 1 : 0;
+			}
+		}
+	}
+
+	Super::HandleGameplayCue(TargetActor, GameplayCueTag, EventType, Parameters, Options);
+}
+
+float ULyraGameplayCueManager::GetCueInvocationHitRate() const
+{
+	const int32 NumInvocations = NumCueInvocationHits + NumLateLoadedCues;
+	return (NumInvocations > 0) ? (100.0f * NumCueInvocationHits / NumInvocations) : 100.0f;
+}
+
 void ULyraGameplayCueManager::DumpGameplayCues(const TArray<FString>& Args)
 {
 	ULyraGameplayCueManager* GCM = Cast<ULyraGameplayCueManager>(UAbilitySystemGlobals::Get().GetGameplayCueManager());
@@ -171,9 +269,12 @@ void ULyraGameplayCueManager::DumpGameplayCues(const TArray<FString>& Args)
 
 	UE_LOG(LogLyra, Log, TEXT("=========== Gameplay Cue Notify summary ==========="));
 	UE_LOG(LogLyra, Log, TEXT("  ... %d cues in always loaded list"), GCM->AlwaysLoadedCues.Num());
-	UE_LOG(LogLyra, Log, TEXT("  ... %d cues in preloaded list"), GCM->PreloadedCues.Num());
+	UE_LOG(LogLyra, Log, TEXT("  ... %d cues in preloaded list (peak %d)"), GCM->PreloadedCues.Num(), GCM->PeakNumPreloadedCues);
 	UE_LOG(LogLyra, Log, TEXT("  ... %d cues loaded on demand"), NumMissingCuesLoaded);
 	UE_LOG(LogLyra, Log, TEXT("  ... %d cues in total"), GCM->AlwaysLoadedCues.Num() + GCM->PreloadedCues.Num() + NumMissingCuesLoaded);
+	UE_LOG(LogLyra, Log, TEXT("  ... %d preloads waiting to start"), GCM->PendingPreloads.Num());
+	UE_LOG(LogLyra, Log, TEXT("  ... %.1f KB estimated for preloaded cues"), GCM->PreloadedCuesEstimatedSize / 1024.0);
+	UE_LOG(LogLyra, Log, TEXT("  ... %.1f%% hit rate (%d late loaded cues)"), GCM->GetCueInvocationHitRate(), GCM->GetNumLateLoadedCues());
 }
 
 void ULyraGameplayCueManager::OnGameplayTagLoaded(const FGameplayTag& Tag)
@@ -280,13 +381,50 @@ void ULyraGameplayCueManager::ProcessTagToPreload(const FGameplayTag& Tag, UObje
 		}
 		else
 		{
+			// Queue the load, only a limited number of them are started each frame
 			bool bAlwaysLoadedCue = OwningObject == nullptr;
 			TWeakObjectPtr<UObject> WeakOwner = OwningObject;
-			StreamableManager.RequestAsyncLoad(CueData.GameplayCueNotifyObj, FStreamableDelegate::CreateUObject(this, &ThisClass::OnPreloadCueComplete, CueData.GameplayCueNotifyObj, WeakOwner, bAlwaysLoadedCue), FStreamableManager::DefaultAsyncLoadPriority, false, false, TEXT("GameplayCueManager"));
+			PendingPreloads.Emplace(CueData.GameplayCueNotifyObj, WeakOwner, bAlwaysLoadedCue);
+
+			if (!PreloadTickHandle.IsValid())
+			{
+				PreloadTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::HandlePreloadTick), 0.0f);
+			}
 		}
 	}
 }
 
+bool ULyraGameplayCueManager::HandlePreloadTick(float DeltaTime)
+{
+	const int32 MaxLoads = LyraGameplayCueManagerCvars::MaxAsyncLoadsPerFrame;
+
+	int32 NumProcessed = 0;
+	int32 NumStarted = 0;
+	while ((NumProcessed < PendingPreloads.Num()) && ((MaxLoads <= 0) || (NumStarted < MaxLoads)))
+	{
+		const FPendingCuePreload& Preload = PendingPreloads[NumProcessed++];
+
+		// Skip loads that are no longer wanted
+		if (!Preload.bAlwaysLoadedCue && !Preload.WeakOwner.IsValid())
+		{
+			continue;
+		}
+
+		StreamableManager.RequestAsyncLoad(Preload.Path, FStreamableDelegate::CreateUObject(this, &ThisClass::OnPreloadCueComplete, Preload.Path, Preload.WeakOwner, Preload.bAlwaysLoadedCue), FStreamableManager::DefaultAsyncLoadPriority, false, false, TEXT("GameplayCueManager"));
+		++NumStarted;
+	}
+
+	PendingPreloads.RemoveAt(0, NumProcessed, /*bAllowShrinking=*/ false);
+
+	if (PendingPreloads.Num() == 0)
+	{
+		PreloadTickHandle.Reset();
+		return false;
+	}
+
+	return true;
+}
+
 void ULyraGameplayCueManager::OnPreloadCueComplete(FSoftObjectPath Path, TWeakObjectPtr<UObject> OwningObject, bool bAlwaysLoadedCue)
 {
 	if (bAlwaysLoadedCue || OwningObject.IsValid())
@@ -308,12 +446,141 @@ void ULyraGameplayCueManager::RegisterPreloadedCue(UClass* LoadedGameplayCueClas
 		AlwaysLoadedCues.Add(LoadedGameplayCueClass);
 		PreloadedCues.Remove(LoadedGameplayCueClass);
 		PreloadedCueReferencers.Remove(LoadedGameplayCueClass);
+
+		FPreloadedCueUsage Usage;
+		if (PreloadedCueUsage.RemoveAndCopyValue(LoadedGameplayCueClass, Usage))
+		{
+			PreloadedCuesEstimatedSize -= Usage.EstimatedSize;
+		}
 	}
 	else if ((OwningObject != LoadedGameplayCueClass) && (OwningObject != LoadedGameplayCueClass->GetDefaultObject()) && !AlwaysLoadedCues.Contains(LoadedGameplayCueClass))
 	{
 		PreloadedCues.Add(LoadedGameplayCueClass);
 		TSet<FObjectKey>& ReferencerSet = PreloadedCueReferencers.FindOrAdd(LoadedGameplayCueClass);
 		ReferencerSet.Add(OwningObject);
+
+		FPreloadedCueUsage& Usage = PreloadedCueUsage.FindOrAdd(LoadedGameplayCueClass);
+		Usage.LastUseTime = FPlatformTime::Seconds();
+		if (Usage.PackageName.IsNone())
+		{
+			Usage.PackageName = LoadedGameplayCueClass->GetOutermost()->GetFName();
+			if (const SIZE_T* EstimatedSize = CueMemoryEstimates.Find(Usage.PackageName))
+			{
+				Usage.EstimatedSize = *EstimatedSize;
+				PreloadedCuesEstimatedSize += Usage.EstimatedSize;
+			}
+			else
+			{
+				RequestCueMemoryEstimate(Usage.PackageName);
+			}
+		}
+
+		PeakNumPreloadedCues = FMath::Max(PeakNumPreloadedCues, PreloadedCues.Num());
+
+		EnforcePreloadBudget();
+	}
+}
+
+void ULyraGameplayCueManager::RequestCueMemoryEstimate(FName PackageName)
+{
+	if (PendingCueMemoryEstimates.Contains(PackageName))
+	{
+		return;
+	}
+	PendingCueMemoryEstimates.Add(PackageName);
+
+	// The estimate only needs the asset registry, computed once per cue package on a worker thread and cached from then on
+	const IAssetRegistry* AssetRegistry = &UAssetManager::Get().GetAssetRegistry();
+	TWeakObjectPtr<ThisClass> WeakThis(this);
+	Async(EAsyncExecution::TaskGraph, [AssetRegistry, PackageName, WeakThis]()
+	{
+		const SIZE_T EstimatedSize = LyraGameplayCueManager::EstimateCueMemory(*AssetRegistry, PackageName);
+		AsyncTask(ENamedThreads::GameThread, [PackageName, EstimatedSize, WeakThis]()
+		{
+			if (ThisClass* StrongThis = WeakThis.Get())
+			{
+				StrongThis->OnCueMemoryEstimated(PackageName, EstimatedSize);
+			}
+		});
+	});
+}
+
+void ULyraGameplayCueManager::OnCueMemoryEstimated(FName PackageName, SIZE_T EstimatedSize)
+{
+	PendingCueMemoryEstimates.Remove(PackageName);
+	CueMemoryEstimates.Add(PackageName, EstimatedSize);
+
+	// The cue may have been evicted (or released by a map change) while the estimate was running
+	bool bAnyCueUpdated = false;
+	for (TPair<FObjectKey, FPreloadedCueUsage>& UsagePair : PreloadedCueUsage)
+	{
+		FPreloadedCueUsage& Usage = UsagePair.Value;
+		if ((Usage.PackageName == PackageName) && (Usage.EstimatedSize != EstimatedSize))
+		{
+			PreloadedCuesEstimatedSize -= Usage.EstimatedSize;
+			Usage.EstimatedSize = EstimatedSize;
+			PreloadedCuesEstimatedSize += Usage.EstimatedSize;
+			bAnyCueUpdated = true;
+		}
+	}
+
+	if (bAnyCueUpdated)
+	{
+		EnforcePreloadBudget();
+	}
+}
+
+void ULyraGameplayCueManager::EnforcePreloadBudget()
+{
+	const int32 MaxCues = LyraGameplayCueManagerCvars::MaxPreloadedCues;
+	const SIZE_T MaxBytes = (SIZE_T)FMath::Max(LyraGameplayCueManagerCvars::MaxPreloadedCueMemoryKB, 0) * 1024;
+
+	auto IsOverBudget = [&]()
+	{
+		return ((MaxCues > 0) && (PreloadedCues.Num() > MaxCues)) || ((MaxBytes > 0) && (PreloadedCuesEstimatedSize > MaxBytes));
+	};
+
+	while (IsOverBudget())
+	{
+		UClass* LeastRecentlyUsedCue = nullptr;
+		double OldestUseTime = TNumericLimits<double>::Max();
+		for (UClass* CueClass : PreloadedCues)
+		{
+			const FPreloadedCueUsage* Usage = PreloadedCueUsage.Find(CueClass);
+			const double LastUseTime = Usage ? Usage->LastUseTime : 0.0;
+			if (LastUseTime < OldestUseTime)
+			{
+				OldestUseTime = LastUseTime;
+				LeastRecentlyUsedCue = CueClass;
+			}
+		}
+
+		if (LeastRecentlyUsedCue == nullptr)
+		{
+			break;
+		}
+
+		EvictPreloadedCue(LeastRecentlyUsedCue);
+	}
+}
+
+void ULyraGameplayCueManager::EvictPreloadedCue(UClass* CueClass)
+{
+	UE_LOG(LogLyra, Verbose, TEXT("Releasing preloaded gameplay cue %s (over budget)"), *GetPathNameSafe(CueClass));
+
+	// Once nothing holds on to the class it can be garbage collected, it will be loaded on demand if it is invoked again
+	if (RuntimeGameplayCueObjectLibrary.CueSet)
+	{
+		RuntimeGameplayCueObjectLibrary.CueSet->RemoveLoadedClass(CueClass);
+	}
+
+	PreloadedCues.Remove(CueClass);
+	PreloadedCueReferencers.Remove(CueClass);
+
+	FPreloadedCueUsage Usage;
+	if (PreloadedCueUsage.RemoveAndCopyValue(CueClass, Usage))
+	{
+		PreloadedCuesEstimatedSize -= Usage.EstimatedSize;
 	}
 }
 
@@ -345,6 +612,13 @@ void ULyraGameplayCueManager::HandlePostLoadMap(UWorld* NewWorld)
 		if (ReferencerSet.Num() == 0)
 		{
 			PreloadedCueReferencers.Remove(*CueIt);
+
+			FPreloadedCueUsage Usage;
+			if (PreloadedCueUsage.RemoveAndCopyValue(*CueIt, Usage))
+			{
+				PreloadedCuesEstimatedSize -= Usage.EstimatedSize;
+			}
+
 			CueIt.RemoveCurrent();
 		}
 	}
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameplayCueManager.h"
+#include "Containers/Ticker.h"
 
 #include "LyraGameplayCueManager.generated.h"
 
@@ -27,6 +28,7 @@ public:
 	virtual bool ShouldAsyncLoadRuntimeObjectLibraries() const override;
 	virtual bool ShouldSyncLoadMissingGameplayCues() const override;
 	virtual bool ShouldAsyncLoadMissingGameplayCues() const override;
+	virtual void HandleGameplayCue(AActor* TargetActor, FGameplayTag GameplayCueTag, EGameplayCueEvent::Type EventType, const FGameplayCueParameters& Parameters, EGameplayCueExecutionOptions Options = EGameplayCueExecutionOptions::Default) override;
 	//~End of UGameplayCueManager interface
 
 	static void DumpGameplayCues(const TArray<FString>& Args);
@@ -37,6 +39,15 @@ public:
 	// Updates the bundles for the singular gameplay cue primary asset
 	void RefreshGameplayCuePrimaryAsset();
 
+	// Number of cue invocations that found their notify class already loaded
+	int32 GetNumCueInvocationHits() const { return NumCueInvocationHits; }
+
+	// Number of cue invocations that had to wait for their notify class to be loaded on demand (the cue plays late or not at all)
+	int32 GetNumLateLoadedCues() const { return NumLateLoadedCues; }
+
+	// Percentage of cue invocations that found their notify class already loaded
+	float GetCueInvocationHitRate() const;
+
 private:
 	void OnGameplayTagLoaded(const FGameplayTag& Tag);
 	void HandlePostGarbageCollect();
@@ -48,6 +59,17 @@ private:
 	void UpdateDelayLoadDelegateListeners();
 	bool ShouldDelayLoadGameplayCues() const;
 
+	// Starts queued preloads, limited to a number of new async loads per frame
+	bool HandlePreloadTick(float DeltaTime);
+
+	// Evicts the least recently invoked preloaded cues until we are back under the count and memory budgets
+	void EnforcePreloadBudget();
+	void EvictPreloadedCue(UClass* CueClass);
+
+	// Estimates the size of a cue package on a worker thread, OnCueMemoryEstimated applies it to the preloaded cues in that package
+	void RequestCueMemoryEstimate(FName PackageName);
+	void OnCueMemoryEstimated(FName PackageName, SIZE_T EstimatedSize);
+
 private:
 	struct FLoadedGameplayTagToProcessData
 	{
@@ -58,6 +80,28 @@ private:
 		FLoadedGameplayTagToProcessData(const FGameplayTag& InTag, const TWeakObjectPtr<UObject>& InWeakOwner) : Tag(InTag), WeakOwner(InWeakOwner) {}
 	};
 
+	struct FPendingCuePreload
+	{
+		FSoftObjectPath Path;
+		TWeakObjectPtr<UObject> WeakOwner;
+		bool bAlwaysLoadedCue = false;
+
+		FPendingCuePreload() {}
+		FPendingCuePreload(const FSoftObjectPath& InPath, const TWeakObjectPtr<UObject>& InWeakOwner, bool bInAlwaysLoadedCue) : Path(InPath), WeakOwner(InWeakOwner), bAlwaysLoadedCue(bInAlwaysLoadedCue) {}
+	};
+
+	struct FPreloadedCueUsage
+	{
+		// Last time (FPlatformTime::Seconds) the cue was invoked, or preloaded if it hasn't been invoked yet
+		double LastUseTime = 0.0;
+
+		// Package of the cue class, its estimate is looked up in CueMemoryEstimates
+		FName PackageName;
+
+		// Estimated memory used by the cue and the assets it hard references, 0 until the estimate has been computed
+		SIZE_T EstimatedSize = 0;
+	};
+
 private:
 	// Cues that were preloaded on the client due to being referenced by content
 	UPROPERTY(transient)
@@ -68,6 +112,24 @@ private:
 	UPROPERTY(transient)
 	TSet<UClass*> AlwaysLoadedCues;
 
+	// Usage of the cues in PreloadedCues, used to pick eviction candidates when over budget
+	TMap<FObjectKey, FPreloadedCueUsage> PreloadedCueUsage;
+	SIZE_T PreloadedCuesEstimatedSize = 0;
+
+	// Estimated sizes by cue package, kept after the cues are released so a cue that is preloaded again doesn't need a new estimate
+	TMap<FName, SIZE_T> CueMemoryEstimates;
+	TSet<FName> PendingCueMemoryEstimates;
+
+	// Most cues PreloadedCues has held at once, reported by Lyra.DumpGameplayCues to choose Lyra.GameplayCues.MaxPreloadedCues from
+	int32 PeakNumPreloadedCues = 0;
+
+	// Preloads waiting for a slot in the per-frame async load budget
+	TArray<FPendingCuePreload> PendingPreloads;
+	FTSTicker::FDelegateHandle PreloadTickHandle;
+
+	int32 NumCueInvocationHits = 0;
+	int32 NumLateLoadedCues = 0;
+
 	TArray<FLoadedGameplayTagToProcessData> LoadedGameplayTagsToProcess;
 	FCriticalSection LoadedGameplayTagsToProcessCS;
 	bool bProcessLoadedTagsAfterGC = false;
@@ -3,8 +3,8 @@
 #include "LyraAnimInstance.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
-#include "Character/SwgcCharacter.h"
-#include "Character/LyraCharacterMovementComponent.h"
+#include "GameFramework/Character.h"
+#include "Character/SwgcCharacterMovementComponent.h"
 
 
 ULyraAnimInstance::ULyraAnimInstance(const FObjectInitializer& ObjectInitializer)
@@ -36,6 +36,15 @@ void ULyraAnimInstance::NativeInitializeAnimation()
 
 	if (AActor* OwningActor = GetOwningActor())
 	{
+		if (const ACharacter* Character = Cast<ACharacter>(OwningActor))
+		{
+			MovementComponent = Cast<USwgcCharacterMovementComponent>(Character->GetCharacterMovement());
+			if (MovementComponent)
+			{
+				MovementComponent->RegisterGroundInfoReader();
+			}
+		}
+
 		if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(OwningActor))
 		{
 			InitializeWithAbilitySystem(ASC);
@@ -43,17 +52,13 @@ void ULyraAnimInstance::NativeInitializeAnimation()
 	}
 }
 
-void ULyraAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
+void ULyraAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
 {
-	Super::NativeUpdateAnimation(DeltaSeconds);
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
 
-	const ASwgcCharacter* Character = Cast<ASwgcCharacter>(GetOwningActor());
-	if (!Character)
+	// Refreshed by the movement tick, which runs before the mesh ticks
+	if (MovementComponent)
 	{
-		return;
+		GroundDistance = MovementComponent->GetCachedGroundInfo().GroundDistance;
 	}
-
-	ULyraCharacterMovementComponent* CharMoveComp = CastChecked<ULyraCharacterMovementComponent>(Character->GetCharacterMovement());
-	const FLyraCharacterGroundInfo& GroundInfo = CharMoveComp->GetGroundInfo();
-	GroundDistance = GroundInfo.GroundDistance;
 }
@@ -8,6 +8,7 @@
 #include "LyraAnimInstance.generated.h"
 
 class UAbilitySystemComponent;
+class USwgcCharacterMovementComponent;
 
 
 /**
@@ -33,7 +34,7 @@ protected:
 #endif // WITH_EDITOR
 
 	virtual void NativeInitializeAnimation() override;
-	virtual void NativeUpdateAnimation(float DeltaSeconds) override;
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
 
 protected:
 
@@ -44,4 +45,10 @@ protected:
 
 	UPROPERTY(BlueprintReadOnly, Category = "Character State Data")
 	float GroundDistance = -1.0f;
+
+private:
+
+	// Cached at initialization so the worker thread update never has to cast the owning actor or its components.
+	UPROPERTY(Transient)
+	TObjectPtr<USwgcCharacterMovementComponent> MovementComponent;
 };
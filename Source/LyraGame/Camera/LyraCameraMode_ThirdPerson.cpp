@@ -164,6 +164,35 @@ void ULyraCameraMode_ThirdPerson::UpdatePreventPenetration(float DeltaTime)
 	}
 }
 
+bool ULyraCameraMode_ThirdPerson::ShouldIgnoreFeelerHit(const AActor& ViewTarget, const FHitResult& Hit, FCollisionQueryParams& SphereParams) const
+{
+	const AActor* HitActor = Hit.GetActor();
+
+	if (HitActor->ActorHasTag(LyraCameraMode_ThirdPerson_Statics::NAME_IgnoreCameraCollision))
+	{
+		SphereParams.AddIgnoredActor(HitActor);
+		return true;
+	}
+
+	// Ignore CameraBlockingVolume hits that occur in front of the ViewTarget.
+	if (HitActor->IsA<ACameraBlockingVolume>())
+	{
+		const FVector ViewTargetForwardXY = ViewTarget.GetActorForwardVector().GetSafeNormal2D();
+		const FVector ViewTargetLocation = ViewTarget.GetActorLocation();
+		const FVector HitOffset = Hit.Location - ViewTargetLocation;
+		const FVector HitDirectionXY = HitOffset.GetSafeNormal2D();
+		const float DotHitDirection = FVector::DotProduct(ViewTargetForwardXY, HitDirectionXY);
+		if (DotHitDirection > 0.0f)
+		{
+			// Ignore this CameraBlockingVolume on the remaining sweeps.
+			SphereParams.AddIgnoredActor(HitActor);
+			return true;
+		}
+	}
+
+	return false;
+}
+
 void ULyraCameraMode_ThirdPerson::PreventCameraPenetration(class AActor const& ViewTarget, FVector const& SafeLoc, FVector& CameraLoc, float const& DeltaTime, float& DistBlockedPct, bool bSingleRayOnly)
 {
 #if ENABLE_DRAW_DEBUG
@@ -195,9 +224,77 @@ void ULyraCameraMode_ThirdPerson::PreventCameraPenetration(class AActor const& V
 	FCollisionShape SphereShape = FCollisionShape::MakeSphere(0.f);
 	UWorld* World = GetWorld();
 
+	// Results of async sweeps from a previous location are of no use after a reset, and none are needed when only the main ray runs
+	if (bSingleRayOnly || !bUseAsyncPredictiveFeelers || bResetInterpolation)
+	{
+		PendingFeelerTraceHandles.Reset();
+		AsyncFeelerBlockedPcts.Reset();
+	}
+	PendingFeelerTraceHandles.SetNum(PenetrationAvoidanceFeelers.Num());
+	if (AsyncFeelerBlockedPcts.Num() != PenetrationAvoidanceFeelers.Num())
+	{
+		AsyncFeelerBlockedPcts.Init(1.f, PenetrationAvoidanceFeelers.Num());
+	}
+
+	// Returns the blocked percentage of the feeler (1 if the hit doesn't block it)
+	auto ProcessFeelerHit = [&](FLyraPenetrationAvoidanceFeeler& Feeler, const FHitResult& Hit, const FVector& TraceStart, const FVector& TraceEnd)
+	{
+		const AActor* HitActor = Hit.GetActor();
+		if (HitActor && !ShouldIgnoreFeelerHit(ViewTarget, Hit, SphereParams))
+		{
+			const float NewBlockPct = ComputeFeelerBlockedPct(TraceStart, TraceEnd, Hit.Location, CollisionPushOutDistance);
+			DistBlockedPctThisFrame = FMath::Min(NewBlockPct, DistBlockedPctThisFrame);
+
+			// This feeler got a hit, so do another trace next frame
+			Feeler.FramesUntilNextTrace = 0;
+
+#if ENABLE_DRAW_DEBUG
+			DebugActorsHitDuringCameraPenetration.AddUnique(TObjectPtr<const AActor>(HitActor));
+#endif
+			return NewBlockPct;
+		}
+
+		return 1.f;
+	};
+
 	for (int32 RayIdx = 0; RayIdx < NumRaysToShoot; ++RayIdx)
 	{
 		FLyraPenetrationAvoidanceFeeler& Feeler = PenetrationAvoidanceFeelers[RayIdx];
+
+		// The main ray stays synchronous so the camera never ends up inside geometry, the predictive
+		// feelers only pull the camera in ahead of time and can afford to be a frame late.
+		const bool bAsyncFeeler = bUseAsyncPredictiveFeelers && (RayIdx > 0);
+
+		// Consume the sweep that was issued last frame
+		FTraceHandle& PendingTraceHandle = PendingFeelerTraceHandles[RayIdx];
+		if (bAsyncFeeler && PendingTraceHandle.IsValid())
+		{
+			FTraceDatum TraceDatum;
+			if (World->QueryTraceData(PendingTraceHandle, TraceDatum))
+			{
+				const FHitResult* Hit = FHitResult::GetFirstBlockingHit(TraceDatum.OutHits);
+				AsyncFeelerBlockedPcts[RayIdx] = Hit ? ProcessFeelerHit(Feeler, *Hit, TraceDatum.Start, TraceDatum.End) : 1.f;
+				PendingTraceHandle = FTraceHandle();
+			}
+			else
+			{
+				// Not available yet (e.g., a second update in the frame the sweep was issued), keep using what this feeler found last
+				DistBlockedPctThisFrame = FMath::Min(AsyncFeelerBlockedPcts[RayIdx], DistBlockedPctThisFrame);
+
+				if (World->IsTraceHandleValid(PendingTraceHandle, /*bOverlapTrace=*/ false))
+				{
+					// Still in flight, keep waiting on it rather than issuing another
+					SoftBlockedPct = DistBlockedPctThisFrame;
+					continue;
+				}
+
+				// The results expired before we got to them, so sweep again
+				PendingTraceHandle = FTraceHandle();
+			}
+
+			SoftBlockedPct = DistBlockedPctThisFrame;
+		}
+
 		if (Feeler.FramesUntilNextTrace <= 0)
 		{
 			// calc ray target
@@ -213,6 +310,14 @@ void ULyraCameraMode_ThirdPerson::PreventCameraPenetration(class AActor const& V
 			SphereShape.Sphere.Radius = Feeler.Extent;
 			ECollisionChannel TraceChannel = ECC_Camera;		//(Feeler.PawnWeight > 0.f) ? ECC_Pawn : ECC_Camera;
 
+			Feeler.FramesUntilNextTrace = Feeler.TraceInterval;
+
+			if (bAsyncFeeler)
+			{
+				PendingTraceHandle = World->AsyncSweepByChannel(EAsyncTraceType::Single, SafeLoc, RayTarget, FQuat::Identity, TraceChannel, SphereShape, SphereParams);
+				continue;
+			}
+
 			// do multi-line check to make sure the hits we throw out aren't
 			// masking real hits behind (these are important rays).
 
@@ -228,59 +333,9 @@ void ULyraCameraMode_ThirdPerson::PreventCameraPenetration(class AActor const& V
 			}
 #endif // ENABLE_DRAW_DEBUG
 
-			Feeler.FramesUntilNextTrace = Feeler.TraceInterval;
-
-			const AActor* HitActor = Hit.GetActor();
-
-			if (bHit && HitActor)
+			if (bHit)
 			{
-				bool bIgnoreHit = false;
-
-				if (HitActor->ActorHasTag(LyraCameraMode_ThirdPerson_Statics::NAME_IgnoreCameraCollision))
-				{
-					bIgnoreHit = true;
-					SphereParams.AddIgnoredActor(HitActor);
-				}
-
-				// Ignore CameraBlockingVolume hits that occur in front of the ViewTarget.
-				if (!bIgnoreHit && HitActor->IsA<ACameraBlockingVolume>())
-				{
-					const FVector ViewTargetForwardXY = ViewTarget.GetActorForwardVector().GetSafeNormal2D();
-					const FVector ViewTargetLocation = ViewTarget.GetActorLocation();
-					const FVector HitOffset = Hit.Location - ViewTargetLocation;
-					const FVector HitDirectionXY = HitOffset.GetSafeNormal2D();
-					const float DotHitDirection = FVector::DotProduct(ViewTargetForwardXY, HitDirectionXY);
-					if (DotHitDirection > 0.0f)
-					{
-						bIgnoreHit = true;
-						// Ignore this CameraBlockingVolume on the remaining sweeps.
-						SphereParams.AddIgnoredActor(HitActor);
-					}
-					else
-					{
-#if ENABLE_DRAW_DEBUG
-						DebugActorsHitDuringCameraPenetration.AddUnique(TObjectPtr<const AActor>(HitActor));
-#endif
-					}
-				}
-				
-				if (!bIgnoreHit)
-				{
-					float const Weight = Cast<APawn>(Hit.GetActor()) ? Feeler.PawnWeight : Feeler.WorldWeight;
-					float NewBlockPct = Hit.Time;
-					NewBlockPct += (1.f - NewBlockPct) * (1.f - Weight);
-
-					// Recompute blocked pct taking into account pushout distance.
-					NewBlockPct = ((Hit.Location - SafeLoc).Size() - CollisionPushOutDistance) / (RayTarget - SafeLoc).Size();
-					DistBlockedPctThisFrame = FMath::Min(NewBlockPct, DistBlockedPctThisFrame);
-
-					// This feeler got a hit, so do another trace next frame
-					Feeler.FramesUntilNextTrace = 0;
-
-#if ENABLE_DRAW_DEBUG
-					DebugActorsHitDuringCameraPenetration.AddUnique(TObjectPtr<const AActor>(HitActor));
-#endif
-				}
+				ProcessFeelerHit(Feeler, Hit, SafeLoc, RayTarget);
 			}
 
 			if (RayIdx == 0)
@@ -300,6 +355,21 @@ void ULyraCameraMode_ThirdPerson::PreventCameraPenetration(class AActor const& V
 		}
 	}
 
+	DistBlockedPct = BlendDistBlockedPct(DistBlockedPct, DistBlockedPctThisFrame, HardBlockedPct, SoftBlockedPct, DeltaTime, PenetrationBlendInTime, PenetrationBlendOutTime, bResetInterpolation);
+	if (DistBlockedPct < (1.f - ZERO_ANIMWEIGHT_THRESH))
+	{
+		CameraLoc = SafeLoc + (CameraLoc - SafeLoc) * DistBlockedPct;
+	}
+}
+
+float ULyraCameraMode_ThirdPerson::ComputeFeelerBlockedPct(const FVector& TraceStart, const FVector& TraceEnd, const FVector& HitLocation, float PushOutDistance)
+{
+	// Blocked pct taking into account pushout distance.
+	return ((HitLocation - TraceStart).Size() - PushOutDistance) / (TraceEnd - TraceStart).Size();
+}
+
+float ULyraCameraMode_ThirdPerson::BlendDistBlockedPct(float DistBlockedPct, float DistBlockedPctThisFrame, float HardBlockedPct, float SoftBlockedPct, float DeltaTime, float BlendInTime, float BlendOutTime, bool bResetInterpolation)
+{
 	if (bResetInterpolation)
 	{
 		DistBlockedPct = DistBlockedPctThisFrame;
@@ -307,9 +377,9 @@ void ULyraCameraMode_ThirdPerson::PreventCameraPenetration(class AActor const& V
 	else if (DistBlockedPct < DistBlockedPctThisFrame)
 	{
 		// interpolate smoothly out
-		if (PenetrationBlendOutTime > DeltaTime)
+		if (BlendOutTime > DeltaTime)
 		{
-			DistBlockedPct = DistBlockedPct + DeltaTime / PenetrationBlendOutTime * (DistBlockedPctThisFrame - DistBlockedPct);
+			DistBlockedPct = DistBlockedPct + DeltaTime / BlendOutTime * (DistBlockedPctThisFrame - DistBlockedPct);
 		}
 		else
 		{
@@ -325,9 +395,9 @@ void ULyraCameraMode_ThirdPerson::PreventCameraPenetration(class AActor const& V
 		else if (DistBlockedPct > SoftBlockedPct)
 		{
 			// interpolate smoothly in
-			if (PenetrationBlendInTime > DeltaTime)
+			if (BlendInTime > DeltaTime)
 			{
-				DistBlockedPct = DistBlockedPct - DeltaTime / PenetrationBlendInTime * (DistBlockedPct - SoftBlockedPct);
+				DistBlockedPct = DistBlockedPct - DeltaTime / BlendInTime * (DistBlockedPct - SoftBlockedPct);
 			}
 			else
 			{
@@ -336,11 +406,7 @@ void ULyraCameraMode_ThirdPerson::PreventCameraPenetration(class AActor const& V
 		}
 	}
 
-	DistBlockedPct = FMath::Clamp<float>(DistBlockedPct, 0.f, 1.f);
-	if (DistBlockedPct < (1.f - ZERO_ANIMWEIGHT_THRESH))
-	{
-		CameraLoc = SafeLoc + (CameraLoc - SafeLoc) * DistBlockedPct;
-	}
+	return FMath::Clamp<float>(DistBlockedPct, 0.f, 1.f);
 }
 
 void ULyraCameraMode_ThirdPerson::SetTargetCrouchOffset(FVector NewTargetOffset)
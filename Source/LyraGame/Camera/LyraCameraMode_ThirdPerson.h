@@ -7,6 +7,7 @@
 #include "Curves/CurveFloat.h"
 #include "LyraPenetrationAvoidanceFeeler.h"
 #include "DrawDebugHelpers.h"
+#include "WorldCollision.h"
 #include "LyraCameraMode_ThirdPerson.generated.h"
 
 class UCurveVector;
@@ -25,6 +26,13 @@ public:
 
 	ULyraCameraMode_ThirdPerson();
 
+	// Blends the current blocked percentage toward the one found by the feelers this frame.
+	// Doesn't touch the world, so it can be run against recorded feeler results.
+	static float BlendDistBlockedPct(float DistBlockedPct, float DistBlockedPctThisFrame, float HardBlockedPct, float SoftBlockedPct, float DeltaTime, float BlendInTime, float BlendOutTime, bool bResetInterpolation);
+
+	// Returns how far along the feeler ray from TraceStart to TraceEnd the camera can go when the ray hit at HitLocation
+	static float ComputeFeelerBlockedPct(const FVector& TraceStart, const FVector& TraceEnd, const FVector& HitLocation, float PushOutDistance);
+
 protected:
 
 	virtual void UpdateView(float DeltaTime) override;
@@ -32,6 +40,7 @@ protected:
 	void UpdateForTarget(float DeltaTime);
 	void UpdatePreventPenetration(float DeltaTime);
 	void PreventCameraPenetration(class AActor const& ViewTarget, FVector const& SafeLoc, FVector& CameraLoc, float const& DeltaTime, float& DistBlockedPct, bool bSingleRayOnly);
+	bool ShouldIgnoreFeelerHit(const AActor& ViewTarget, const FHitResult& Hit, FCollisionQueryParams& SphereParams) const;
 
 	virtual void DrawDebug(UCanvas* Canvas) const override;
 
@@ -75,6 +84,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Collision")
 	bool bDoPredictiveAvoidance = true;
 
+	/** If true, the predictive feelers (index 1+) are swept asynchronously and their results are used on the following frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Collision")
+	bool bUseAsyncPredictiveFeelers = true;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Collision")
 	float CollisionPushOutDistance = 2.f;
 
@@ -98,6 +111,12 @@ public:
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<const AActor>> DebugActorsHitDuringCameraPenetration;
 
+	// Async sweeps in flight for the predictive feelers, indexed like PenetrationAvoidanceFeelers
+	TArray<FTraceHandle> PendingFeelerTraceHandles;
+
+	// The blocked percentage each predictive feeler's last async sweep found, used until its next sweep is available
+	TArray<float> AsyncFeelerBlockedPcts;
+
 #if ENABLE_DRAW_DEBUG
 	mutable float LastDrawDebugTime = -MAX_FLT;
 #endif
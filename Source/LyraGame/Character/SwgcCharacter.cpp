@@ -17,12 +17,19 @@
 #include "Player/LyraPlayerController.h"
 #include "Player/LyraPlayerState.h"
 #include "System/LyraSignificanceManager.h"
+#include "SwgcCharacterMovementComponent.h"
 
 static FName NAME_LyraCharacterCollisionProfile_Capsule(TEXT("LyraPawnCapsule"));
 static FName NAME_LyraCharacterCollisionProfile_Mesh(TEXT("LyraPawnMesh"));
 
+namespace SwgcCharacter
+{
+	static bool bReplicateAcceleration = true;
+	FAutoConsoleVariableRef CVar_ReplicateAcceleration(TEXT("SwgcCharacter.ReplicateAcceleration"), bReplicateAcceleration, TEXT("If true, the server replicates quantized acceleration to simulated proxies. Set to 0 on the server to compare replication bandwidth without it."), ECVF_Default);
+}
+
 ASwgcCharacter::ASwgcCharacter(const FObjectInitializer& ObjectInitializer)
-	: Super(ObjectInitializer.SetDefaultSubobjectClass<UAlsCharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<USwgcCharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
 	NetCullDistanceSquared = 900000000.0f;
 
@@ -112,6 +119,49 @@ void ASwgcCharacter::GetLifetimeReplicatedProps(TArray< FLifetimeProperty >& Out
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
 	DOREPLIFETIME(ThisClass, MyTeamID);
+	DOREPLIFETIME_CONDITION(ThisClass, ReplicatedAcceleration, COND_SimulatedOnly);
+}
+
+void ASwgcCharacter::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	DOREPLIFETIME_ACTIVE_OVERRIDE(ThisClass, ReplicatedAcceleration, SwgcCharacter::bReplicateAcceleration);
+
+	const UCharacterMovementComponent* MovementComponent = SwgcCharacter::bReplicateAcceleration ? GetCharacterMovement() : nullptr;
+	if (MovementComponent)
+	{
+		// Compress Acceleration: XY components as direction + magnitude, Z component as direct value
+		const double MaxAccel = FMath::Max(MovementComponent->MaxAcceleration, KINDA_SMALL_NUMBER);
+		const FVector CurrentAccel = MovementComponent->GetCurrentAcceleration();
+		double AccelXYRadians, AccelXYMagnitude;
+		FMath::CartesianToPolar(CurrentAccel.X, CurrentAccel.Y, AccelXYMagnitude, AccelXYRadians);
+		if (AccelXYRadians < 0.0)
+		{
+			AccelXYRadians += TWO_PI;
+		}
+
+		ReplicatedAcceleration.AccelXYRadians   = FMath::RoundToInt((AccelXYRadians / TWO_PI) * 256.0) & 0xFF;                     // [0, 2PI) -> [0, 255]
+		ReplicatedAcceleration.AccelXYMagnitude = FMath::Clamp(FMath::RoundToInt((AccelXYMagnitude / MaxAccel) * 255.0), 0, 255);  // [0, MaxAccel] -> [0, 255]
+		ReplicatedAcceleration.AccelZ           = FMath::Clamp(FMath::RoundToInt((CurrentAccel.Z / MaxAccel) * 127.0), -127, 127); // [-MaxAccel, MaxAccel] -> [-127, 127]
+	}
+}
+
+void ASwgcCharacter::OnRep_ReplicatedAcceleration()
+{
+	if (USwgcCharacterMovementComponent* SwgcMoveComp = Cast<USwgcCharacterMovementComponent>(GetCharacterMovement()))
+	{
+		// Decompress Acceleration
+		const double MaxAccel         = SwgcMoveComp->MaxAcceleration;
+		const double AccelXYMagnitude = double(ReplicatedAcceleration.AccelXYMagnitude) * MaxAccel / 255.0; // [0, 255] -> [0, MaxAccel]
+		const double AccelXYRadians   = double(ReplicatedAcceleration.AccelXYRadians) * TWO_PI / 256.0;     // [0, 255] -> [0, 2PI)
+
+		FVector UnpackedAcceleration(FVector::ZeroVector);
+		FMath::PolarToCartesian(AccelXYMagnitude, AccelXYRadians, UnpackedAcceleration.X, UnpackedAcceleration.Y);
+		UnpackedAcceleration.Z = double(ReplicatedAcceleration.AccelZ) * MaxAccel / 127.0; // [-127, 127] -> [-MaxAccel, MaxAccel]
+
+		SwgcMoveComp->SetReplicatedAcceleration(UnpackedAcceleration);
+	}
 }
 
 
@@ -17,6 +17,29 @@ class UInputMappingContext;
 class UInputAction;
 struct FInputActionValue;
 
+/**
+ * FLyraReplicatedAcceleration
+ *
+ *	Compressed representation of the character's acceleration, replicated to simulated proxies.
+ */
+USTRUCT()
+struct FLyraReplicatedAcceleration
+{
+	GENERATED_BODY()
+
+	// Direction of the XY component, quantized to represent [0, 2*pi)
+	UPROPERTY()
+	uint8 AccelXYRadians = 0;
+
+	// Magnitude of the XY component, quantized to represent [0, MaxAcceleration]
+	UPROPERTY()
+	uint8 AccelXYMagnitude = 0;
+
+	// Z component, quantized to represent [-MaxAcceleration, MaxAcceleration]
+	UPROPERTY()
+	int8 AccelZ = 0;
+};
+
 /**
  * ASwgcCharacter
  *
@@ -55,6 +78,7 @@ public:
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Reset() override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
 	//~End of AActor interface
 
 	//~APawn interface
@@ -122,6 +146,9 @@ private:
 	UPROPERTY(ReplicatedUsing = OnRep_MyTeamID)
 	FGenericTeamId MyTeamID;
 
+	UPROPERTY(Transient, ReplicatedUsing = OnRep_ReplicatedAcceleration)
+	FLyraReplicatedAcceleration ReplicatedAcceleration;
+
 	UPROPERTY()
 	FOnLyraTeamIndexChangedDelegate OnTeamChangedDelegate;
 
@@ -139,6 +166,9 @@ private:
 
 	UFUNCTION()
 	void OnRep_MyTeamID(FGenericTeamId OldTeamID);
+
+	UFUNCTION()
+	void OnRep_ReplicatedAcceleration();
 	// Camera
 
 
@@ -0,0 +1,336 @@
+#include "SwgcCharacterMovementComponent.h"
+#include "SwgcCharacter.h"
+#include "CollisionQueryParams.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Containers/Ticker.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "RenderCore.h"
+#include "LyraLogChannels.h"
+
+namespace SwgcCharacter
+{
+	static float GroundTraceDistance = 100000.0f;
+	FAutoConsoleVariableRef CVar_GroundTraceDistance(TEXT("SwgcCharacter.GroundTraceDistance"), GroundTraceDistance, TEXT("Distance to trace down when generating ground information."), ECVF_Cheat);
+
+	static bool bUseAsyncGroundTrace = true;
+	FAutoConsoleVariableRef CVar_UseAsyncGroundTrace(TEXT("SwgcCharacter.UseAsyncGroundTrace"), bUseAsyncGroundTrace, TEXT("If true, airborne characters trace for the ground asynchronously after their movement tick and animation uses the previous frame's result. If false, the ground is traced synchronously every frame it is read."), ECVF_Default);
+
+#if !UE_BUILD_SHIPPING
+	// Set while SwgcCharacter.GroundTraceBenchmark runs, its pawns have no mesh to read the ground info but should still trace
+	static bool bGroundTraceBenchmarkRunning = false;
+#endif
+}
+
+USwgcCharacterMovementComponent::USwgcCharacterMovementComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+}
+
+void USwgcCharacterMovementComponent::SimulateMovement(float DeltaTime)
+{
+	if (bHasReplicatedAcceleration)
+	{
+		// Preserve our replicated acceleration
+		const FVector OriginalAcceleration = Acceleration;
+		Super::SimulateMovement(DeltaTime);
+		Acceleration = OriginalAcceleration;
+	}
+	else
+	{
+		Super::SimulateMovement(DeltaTime);
+	}
+}
+
+void USwgcCharacterMovementComponent::SetReplicatedAcceleration(const FVector& InAcceleration)
+{
+	bHasReplicatedAcceleration = true;
+	Acceleration = InAcceleration;
+}
+
+void USwgcCharacterMovementComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	// The mesh ticks after the movement component, so its animation update reads what is cached here
+	if (ShouldUpdateGroundInfo())
+	{
+		if (SwgcCharacter::bUseAsyncGroundTrace)
+		{
+			UpdateAsyncGroundTrace();
+		}
+		else
+		{
+			UpdateGroundInfo();
+		}
+	}
+}
+
+bool USwgcCharacterMovementComponent::ShouldUpdateGroundInfo() const
+{
+#if !UE_BUILD_SHIPPING
+	if (SwgcCharacter::bGroundTraceBenchmarkRunning)
+	{
+		return true;
+	}
+#endif
+
+	if (!CharacterOwner)
+	{
+		return false;
+	}
+
+	if ((GFrameCounter - LastGroundInfoRequestFrame) <= 1)
+	{
+		return true;
+	}
+
+	// Animation only reads the ground info when the mesh updates its pose, which culled characters and most dedicated servers skip
+	const USkeletalMeshComponent* MeshComp = CharacterOwner->GetMesh();
+	return bHasGroundInfoReader && MeshComp && MeshComp->ShouldTickPose();
+}
+
+const FLyraCharacterGroundInfo& USwgcCharacterMovementComponent::GetGroundInfo()
+{
+	LastGroundInfoRequestFrame = GFrameCounter;
+
+	if (SwgcCharacter::bUseAsyncGroundTrace)
+	{
+		// Airborne characters keep the result of the async trace consumed by the last movement tick.  On the first airborne
+		// frame this is still the floor we just left, which is accurate enough for animation.
+		if (CharacterOwner && (MovementMode == MOVE_Walking) && (GFrameCounter != CachedGroundInfo.LastUpdateFrame))
+		{
+			CachedGroundInfo.GroundHitResult = CurrentFloor.HitResult;
+			CachedGroundInfo.GroundDistance = 0.0f;
+			CachedGroundInfo.LastUpdateFrame = GFrameCounter;
+		}
+
+		return CachedGroundInfo;
+	}
+
+	UpdateGroundInfo();
+
+	return CachedGroundInfo;
+}
+
+void USwgcCharacterMovementComponent::UpdateGroundInfo()
+{
+	if (!CharacterOwner || (GFrameCounter == CachedGroundInfo.LastUpdateFrame))
+	{
+		return;
+	}
+
+	if (MovementMode == MOVE_Walking)
+	{
+		CachedGroundInfo.GroundHitResult = CurrentFloor.HitResult;
+		CachedGroundInfo.GroundDistance = 0.0f;
+	}
+	else
+	{
+		FVector TraceStart;
+		FVector TraceEnd;
+		ECollisionChannel CollisionChannel;
+		FCollisionQueryParams QueryParams;
+		FCollisionResponseParams ResponseParam;
+		GetGroundTraceParams(TraceStart, TraceEnd, CollisionChannel, QueryParams, ResponseParam);
+
+		FHitResult HitResult;
+		GetWorld()->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, CollisionChannel, QueryParams, ResponseParam);
+
+		ApplyGroundTraceResult(HitResult);
+	}
+
+	CachedGroundInfo.LastUpdateFrame = GFrameCounter;
+}
+
+void USwgcCharacterMovementComponent::UpdateAsyncGroundTrace()
+{
+	UWorld* World = GetWorld();
+	if (!CharacterOwner || !World)
+	{
+		return;
+	}
+
+	if (PendingGroundTraceHandle.IsValid())
+	{
+		FTraceDatum TraceDatum;
+		if (World->QueryTraceData(PendingGroundTraceHandle, TraceDatum))
+		{
+			const FHitResult* BlockingHit = FHitResult::GetFirstBlockingHit(TraceDatum.OutHits);
+			ApplyGroundTraceResult(BlockingHit ? *BlockingHit : FHitResult());
+		}
+
+		PendingGroundTraceHandle = FTraceHandle();
+	}
+
+	CachedGroundInfo.LastUpdateFrame = GFrameCounter;
+
+	// Walking characters get their ground info from the current floor, there's nothing to trace for
+	if (MovementMode == MOVE_Walking)
+	{
+		CachedGroundInfo.GroundHitResult = CurrentFloor.HitResult;
+		CachedGroundInfo.GroundDistance = 0.0f;
+		return;
+	}
+
+	FVector TraceStart;
+	FVector TraceEnd;
+	ECollisionChannel CollisionChannel;
+	FCollisionQueryParams QueryParams;
+	FCollisionResponseParams ResponseParam;
+	GetGroundTraceParams(TraceStart, TraceEnd, CollisionChannel, QueryParams, ResponseParam);
+
+	PendingGroundTraceHandle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, TraceStart, TraceEnd, CollisionChannel, QueryParams, ResponseParam);
+}
+
+void USwgcCharacterMovementComponent::GetGroundTraceParams(FVector& OutTraceStart, FVector& OutTraceEnd, ECollisionChannel& OutCollisionChannel, FCollisionQueryParams& OutQueryParams, FCollisionResponseParams& OutResponseParams) const
+{
+	const UCapsuleComponent* CapsuleComp = CharacterOwner->GetCapsuleComponent();
+	check(CapsuleComp);
+
+	const float CapsuleHalfHeight = CapsuleComp->GetUnscaledCapsuleHalfHeight();
+	OutCollisionChannel = (UpdatedComponent ? UpdatedComponent->GetCollisionObjectType() : ECC_Pawn);
+	OutTraceStart = GetActorLocation();
+	OutTraceEnd = FVector(OutTraceStart.X, OutTraceStart.Y, (OutTraceStart.Z - SwgcCharacter::GroundTraceDistance - CapsuleHalfHeight));
+
+	OutQueryParams = FCollisionQueryParams(SCENE_QUERY_STAT(SwgcCharacterMovementComponent_GetGroundInfo), false, CharacterOwner);
+	InitCollisionParams(OutQueryParams, OutResponseParams);
+}
+
+void USwgcCharacterMovementComponent::ApplyGroundTraceResult(const FHitResult& HitResult)
+{
+	const UCapsuleComponent* CapsuleComp = CharacterOwner->GetCapsuleComponent();
+	check(CapsuleComp);
+
+	const float CapsuleHalfHeight = CapsuleComp->GetUnscaledCapsuleHalfHeight();
+
+	CachedGroundInfo.GroundHitResult = HitResult;
+	CachedGroundInfo.GroundDistance = SwgcCharacter::GroundTraceDistance;
+
+	if (MovementMode == MOVE_NavWalking)
+	{
+		CachedGroundInfo.GroundDistance = 0.0f;
+	}
+	else if (HitResult.bBlockingHit)
+	{
+		CachedGroundInfo.GroundDistance = FMath::Max((HitResult.Distance - CapsuleHalfHeight), 0.0f);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////
+
+#if !UE_BUILD_SHIPPING
+
+namespace SwgcCharacter
+{
+	// Spawns characters flying above the local player and compares the game thread time with synchronous and async ground traces
+	class FGroundTraceBenchmark
+	{
+	public:
+		FGroundTraceBenchmark(UWorld* InWorld, int32 NumPawns, int32 InFramesPerMode)
+			: World(InWorld)
+			, FramesPerMode(FMath::Max(InFramesPerMode, 1))
+			, bOriginalUseAsyncGroundTrace(bUseAsyncGroundTrace)
+		{
+			const APlayerController* PC = InWorld->GetFirstPlayerController();
+			const FVector Origin = ((PC && PC->GetPawn()) ? PC->GetPawn()->GetActorLocation() : FVector::ZeroVector) + FVector(0.0f, 0.0f, 2000.0f);
+			const int32 GridSize = FMath::CeilToInt(FMath::Sqrt((float)NumPawns));
+
+			FActorSpawnParameters SpawnParams;
+			SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+			for (int32 PawnIndex = 0; PawnIndex < NumPawns; ++PawnIndex)
+			{
+				const FVector Location = Origin + FVector((PawnIndex % GridSize) * 200.0f, (PawnIndex / GridSize) * 200.0f, 0.0f);
+				if (ASwgcCharacter* Pawn = InWorld->SpawnActor<ASwgcCharacter>(ASwgcCharacter::StaticClass(), Location, FRotator::ZeroRotator, SpawnParams))
+				{
+					UCharacterMovementComponent* MoveComp = Pawn->GetCharacterMovement();
+					MoveComp->bRunPhysicsWithNoController = true;
+					MoveComp->SetMovementMode(MOVE_Flying);
+					Pawns.Add(Pawn);
+				}
+			}
+
+			bGroundTraceBenchmarkRunning = true;
+			bUseAsyncGroundTrace = false;
+		}
+
+		bool Tick(float DeltaTime)
+		{
+			if (!World.IsValid())
+			{
+				Finish();
+				return false;
+			}
+
+			// GGameThreadTime is the previous frame, skip the first frame of each mode
+			const int32 ModeIndex = bUseAsyncGroundTrace ? 1 : 0;
+			if (FrameInMode > 0)
+			{
+				GameThreadMs[ModeIndex] += FPlatformTime::ToMilliseconds(GGameThreadTime);
+			}
+
+			if (++FrameInMode <= FramesPerMode)
+			{
+				return true;
+			}
+
+			FrameInMode = 0;
+			if (!bUseAsyncGroundTrace)
+			{
+				bUseAsyncGroundTrace = true;
+				return true;
+			}
+
+			UE_LOG(LogLyra, Display, TEXT("Ground trace benchmark, %d flying characters over %d frames: synchronous %.3f ms, async %.3f ms average game thread time"),
+				Pawns.Num(), FramesPerMode, GameThreadMs[0] / FramesPerMode, GameThreadMs[1] / FramesPerMode);
+
+			Finish();
+			return false;
+		}
+
+	private:
+		void Finish()
+		{
+			for (const TWeakObjectPtr<ASwgcCharacter>& Pawn : Pawns)
+			{
+				if (Pawn.IsValid())
+				{
+					Pawn->Destroy();
+				}
+			}
+
+			bUseAsyncGroundTrace = bOriginalUseAsyncGroundTrace;
+			bGroundTraceBenchmarkRunning = false;
+		}
+
+	private:
+		TWeakObjectPtr<UWorld> World;
+		TArray<TWeakObjectPtr<ASwgcCharacter>> Pawns;
+		int32 FramesPerMode = 0;
+		int32 FrameInMode = 0;
+		double GameThreadMs[2] = { 0.0, 0.0 };
+		bool bOriginalUseAsyncGroundTrace = true;
+	};
+
+	static FAutoConsoleCommandWithWorldAndArgs GGroundTraceBenchmarkCmd(
+		TEXT("SwgcCharacter.GroundTraceBenchmark"),
+		TEXT("Spawns airborne characters and logs the average game thread time with synchronous and async ground traces. Optional arguments: number of characters (default 100), frames per mode (default 300)"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(
+			[](const TArray<FString>& Params, UWorld* World)
+			{
+				if ((World == nullptr) || bGroundTraceBenchmarkRunning)
+				{
+					return;
+				}
+
+				const int32 NumPawns = (Params.Num() > 0) ? FCString::Atoi(*Params[0]) : 100;
+				const int32 FramesPerMode = (Params.Num() > 1) ? FCString::Atoi(*Params[1]) : 300;
+
+				TSharedRef<FGroundTraceBenchmark> Benchmark = MakeShared<FGroundTraceBenchmark>(World, NumPawns, FramesPerMode);
+				FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Benchmark](float DeltaTime) { return Benchmark->Tick(DeltaTime); }));
+			}));
+}
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "AlsCharacterMovementComponent.h"
+#include "WorldCollision.h"
+#include "Character/LyraCharacterMovementComponent.h"
+#include "SwgcCharacterMovementComponent.generated.h"
+
+/**
+ * USwgcCharacterMovementComponent
+ *
+ *	The ALS movement component used by ASwgcCharacter, extended so simulated proxies keep the acceleration replicated
+ *	by the server instead of it being reset by SimulateMovement, and so animation can read the ground under the character.
+ */
+UCLASS(Config = Game)
+class LYRAGAME_API USwgcCharacterMovementComponent : public UAlsCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+	USwgcCharacterMovementComponent(const FObjectInitializer& ObjectInitializer);
+
+	virtual void SimulateMovement(float DeltaTime) override;
+
+	void SetReplicatedAcceleration(const FVector& InAcceleration);
+
+	// Returns the current ground info.  Calling this will update the ground info if it's out of date.
+	// While airborne with async ground traces enabled, this is the result of the trace issued after the previous movement tick.
+	UFUNCTION(BlueprintCallable, Category = "Lyra|CharacterMovement")
+	const FLyraCharacterGroundInfo& GetGroundInfo();
+
+	// Returns the ground info as of the last movement tick without updating it.  Safe to read from worker thread animation updates.
+	const FLyraCharacterGroundInfo& GetCachedGroundInfo() const { return CachedGroundInfo; }
+
+	// Called by anim instances that read GetCachedGroundInfo, the movement tick only keeps it up to date for characters that have one.
+	void RegisterGroundInfoReader() { bHasGroundInfoReader = true; }
+
+	//~UActorComponent interface
+	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	//~End of UActorComponent interface
+
+protected:
+	// Returns true if something will read the ground info this frame: a reader whose mesh is updating its pose, or a recent GetGroundInfo call.
+	bool ShouldUpdateGroundInfo() const;
+
+	// Refreshes the ground info with a synchronous trace when airborne.
+	void UpdateGroundInfo();
+
+	// Consumes the ground trace issued last frame (if any) and issues a new one for the current position.
+	void UpdateAsyncGroundTrace();
+
+	void GetGroundTraceParams(FVector& OutTraceStart, FVector& OutTraceEnd, ECollisionChannel& OutCollisionChannel, FCollisionQueryParams& OutQueryParams, FCollisionResponseParams& OutResponseParams) const;
+	void ApplyGroundTraceResult(const FHitResult& HitResult);
+
+protected:
+	UPROPERTY(Transient)
+	bool bHasReplicatedAcceleration = false;
+
+	// Set once an anim instance reading the ground info has initialized.
+	bool bHasGroundInfoReader = false;
+
+	// Cached ground info for the character.  It's updated by the movement tick and when accessed via GetGroundInfo().
+	FLyraCharacterGroundInfo CachedGroundInfo;
+
+	// Handle of the ground trace issued after the last movement tick.
+	FTraceHandle PendingGroundTraceHandle;
+
+	// The last frame GetGroundInfo was called.
+	uint64 LastGroundInfoRequestFrame = 0;
+};
@@ -26,6 +26,22 @@ enum class ECharacterCustomizationCollisionMode : uint8
 
 //////////////////////////////////////////////////////////////////////
 
+// How are character parts represented on the pawn
+UENUM()
+enum class ELyraCharacterPartSpawnMode : uint8
+{
+	// Spawn a child actor for every part
+	ChildActors,
+
+	// Parts that are just a skeletal mesh (no socket, no collision) get a skeletal mesh component following the body's pose instead of an actor
+	LeaderPoseComponents,
+
+	// Like LeaderPoseComponents, but compatible part meshes are merged into a single mesh, shared by every pawn with the same parts
+	MergedMesh
+};
+
+//////////////////////////////////////////////////////////////////////
+
 // A handle created by adding a character part entry, can be used to remove it later
 USTRUCT(BlueprintType)
 struct FLyraCharacterPartHandle
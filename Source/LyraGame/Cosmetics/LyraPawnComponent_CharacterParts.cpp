@@ -6,12 +6,87 @@
 #include "Components/ChildActorComponent.h"
 #include "Net/UnrealNetwork.h"
 #include "GameplayTagAssetInterface.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "Engine/SCS_Node.h"
+#include "Engine/InheritableComponentHandler.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "SkeletalMeshMerge.h"
+#include "LyraLogChannels.h"
+
+//////////////////////////////////////////////////////////////////////
+
+namespace LyraCharacterParts
+{
+	// Merged part meshes keyed by the (sorted) source mesh paths, so every pawn wearing the same parts shares one mesh.
+	// The pawns' components keep the merged meshes alive, entries are dropped once the last user is gone.
+	static TMap<FString, TWeakObjectPtr<USkeletalMesh>> MergedMeshCache;
+
+	static bool CanMergeMesh(const USkeletalMesh* Mesh)
+	{
+		// FSkeletalMeshMerge reads the source vertex data on the CPU
+		for (int32 LODIndex = 0; LODIndex < Mesh->GetLODNum(); ++LODIndex)
+		{
+			const FSkeletalMeshLODInfo* LODInfo = Mesh->GetLODInfo(LODIndex);
+			if ((LODInfo == nullptr) || !LODInfo->bAllowCPUAccess)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	static USkeletalMesh* FindOrCreateMergedMesh(TArray<USkeletalMesh*> SourceMeshes)
+	{
+		SourceMeshes.Sort([](const USkeletalMesh& A, const USkeletalMesh& B) { return A.GetPathName() < B.GetPathName(); });
+
+		FString Key;
+		for (const USkeletalMesh* SourceMesh : SourceMeshes)
+		{
+			Key += SourceMesh->GetPathName();
+			Key += TEXT(";");
+		}
+
+		if (const TWeakObjectPtr<USkeletalMesh>* CachedMesh = MergedMeshCache.Find(Key))
+		{
+			if (USkeletalMesh* MergedMesh = CachedMesh->Get())
+			{
+				return MergedMesh;
+			}
+		}
+
+		// Drop the entries of merged meshes that were garbage collected before adding a new one
+		for (auto It = MergedMeshCache.CreateIterator(); It; ++It)
+		{
+			if (!It.Value().IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		USkeletalMesh* MergedMesh = NewObject<USkeletalMesh>(GetTransientPackage(), NAME_None, RF_Transient);
+		MergedMesh->SetSkeleton(SourceMeshes[0]->GetSkeleton());
+
+		const TArray<FSkelMeshMergeSectionMapping> SectionMappings;
+		FSkeletalMeshMerge Merger(MergedMesh, SourceMeshes, SectionMappings, /*StripTopLODs=*/ 0);
+		if (!Merger.DoMerge())
+		{
+			UE_LOG(LogLyra, Warning, TEXT("Failed to merge character part meshes %s"), *Key);
+			return nullptr;
+		}
+
+		MergedMeshCache.Add(Key, MergedMesh);
+		return MergedMesh;
+	}
+}
 
 //////////////////////////////////////////////////////////////////////
 
 FString FLyraAppliedCharacterPartEntry::GetDebugString() const
 {
-	return FString::Printf(TEXT("(PartClass: %s, Socket: %s, Instance: %s)"), *GetPathNameSafe(Part.PartClass), *Part.SocketName.ToString(), *GetPathNameSafe(SpawnedComponent));
+	const UObject* Instance = SpawnedComponent ? (UObject*)SpawnedComponent : (SpawnedMeshComponent ? (UObject*)SpawnedMeshComponent : (UObject*)MergedMesh);
+	return FString::Printf(TEXT("(PartClass: %s, Socket: %s, Instance: %s)"), *GetPathNameSafe(Part.PartClass), *Part.SocketName.ToString(), *GetPathNameSafe(Instance));
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -137,6 +212,14 @@ FGameplayTagContainer FLyraCharacterPartList::CollectCombinedTags() const
 				TagInterface->GetOwnedGameplayTags(/*inout*/ Result);
 			}
 		}
+		else if ((Entry.SpawnedMeshComponent != nullptr) || (Entry.MergedMesh != nullptr))
+		{
+			// Parts without an actor report the tags of their class default object
+			if (IGameplayTagAssetInterface* TagInterface = Cast<IGameplayTagAssetInterface>(Entry.Part.PartClass->GetDefaultObject()))
+			{
+				TagInterface->GetOwnedGameplayTags(/*inout*/ Result);
+			}
+		}
 	}
 
 	return Result;
@@ -152,7 +235,33 @@ bool FLyraCharacterPartList::SpawnActorForEntry(FLyraAppliedCharacterPartEntry&
 		{
 			UWorld* World = OwnerComponent->GetWorld();
 
-			if (USceneComponent* ComponentToAttachTo = OwnerComponent->GetSceneComponentToAttachTo())
+			const ELyraCharacterPartSpawnMode SpawnMode = OwnerComponent->GetPartSpawnMode();
+			const USkeletalMeshComponent* LightweightTemplate = (SpawnMode != ELyraCharacterPartSpawnMode::ChildActors) ? OwnerComponent->FindLightweightPartTemplate(Entry.Part) : nullptr;
+
+			if (LightweightTemplate != nullptr)
+			{
+				USkeletalMesh* PartMesh = LightweightTemplate->SkeletalMesh;
+				const USkeletalMesh* BodyMesh = OwnerComponent->GetParentMeshComponent()->SkeletalMesh;
+
+				// Only meshes that share the body's skeleton and don't override their materials can be merged
+				const bool bCanMerge = (SpawnMode == ELyraCharacterPartSpawnMode::MergedMesh) &&
+					(LightweightTemplate->OverrideMaterials.Num() == 0) &&
+					BodyMesh && (PartMesh->GetSkeleton() == BodyMesh->GetSkeleton()) &&
+					LyraCharacterParts::CanMergeMesh(PartMesh);
+
+				if (bCanMerge)
+				{
+					// The merged mesh gets rebuilt by BroadcastChanged
+					Entry.MergedMesh = PartMesh;
+				}
+				else
+				{
+					Entry.SpawnedMeshComponent = OwnerComponent->CreateLeaderPoseComponent(PartMesh, LightweightTemplate);
+				}
+
+				bCreatedAnyActors = true;
+			}
+			else if (USceneComponent* ComponentToAttachTo = OwnerComponent->GetSceneComponentToAttachTo())
 			{
 				const FTransform SpawnTransform = ComponentToAttachTo->GetSocketTransform(Entry.Part.SocketName);
 
@@ -202,6 +311,19 @@ bool FLyraCharacterPartList::DestroyActorForEntry(FLyraAppliedCharacterPartEntry
 		bDestroyedAnyActors = true;
 	}
 
+	if (Entry.SpawnedMeshComponent != nullptr)
+	{
+		Entry.SpawnedMeshComponent->DestroyComponent();
+		Entry.SpawnedMeshComponent = nullptr;
+		bDestroyedAnyActors = true;
+	}
+
+	if (Entry.MergedMesh != nullptr)
+	{
+		Entry.MergedMesh = nullptr;
+		bDestroyedAnyActors = true;
+	}
+
 	return bDestroyedAnyActors;
 }
 
@@ -245,6 +367,12 @@ void ULyraPawnComponent_CharacterParts::EndPlay(const EEndPlayReason::Type EndPl
 {
 	CharacterPartList.ClearAllEntries(/*bBroadcastChangeDelegate=*/ false);
 
+	if (MergedPartsComponent != nullptr)
+	{
+		MergedPartsComponent->DestroyComponent();
+		MergedPartsComponent = nullptr;
+	}
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -267,6 +395,151 @@ TArray<AActor*> ULyraPawnComponent_CharacterParts::GetCharacterPartActors() cons
 	return Result;
 }
 
+TArray<USkeletalMeshComponent*> ULyraPawnComponent_CharacterParts::GetCharacterPartMeshComponents() const
+{
+	TArray<USkeletalMeshComponent*> Result;
+
+	for (const FLyraAppliedCharacterPartEntry& Entry : CharacterPartList.Entries)
+	{
+		if (Entry.SpawnedMeshComponent != nullptr)
+		{
+			Result.Add(Entry.SpawnedMeshComponent);
+		}
+	}
+
+	if ((MergedPartsComponent != nullptr) && (MergedPartsComponent->SkeletalMesh != nullptr))
+	{
+		Result.Add(MergedPartsComponent);
+	}
+
+	return Result;
+}
+
+const USkeletalMeshComponent* ULyraPawnComponent_CharacterParts::FindLightweightPartTemplate(const FLyraCharacterPart& Part) const
+{
+	// Parts attached to a socket or that want collision need their actor, and there must be a body mesh to follow
+	if ((Part.PartClass == nullptr) || !Part.SocketName.IsNone() || (Part.CollisionMode != ECharacterCustomizationCollisionMode::NoCollision) || (GetParentMeshComponent() == nullptr))
+	{
+		return nullptr;
+	}
+
+	// The part must consist of a single skeletal mesh component, plus any number of non-primitive scene components
+	const USkeletalMeshComponent* Result = nullptr;
+	bool bIsLightweight = true;
+
+	auto ConsiderComponent = [&Result, &bIsLightweight](const UActorComponent* Component)
+	{
+		if (const USkeletalMeshComponent* MeshComponent = Cast<USkeletalMeshComponent>(Component))
+		{
+			bIsLightweight &= (Result == nullptr) && (MeshComponent->SkeletalMesh != nullptr);
+			Result = MeshComponent;
+		}
+		else if (Component != nullptr)
+		{
+			bIsLightweight &= Component->IsA<USceneComponent>() && !Component->IsA<UPrimitiveComponent>();
+		}
+	};
+
+	const AActor* PartCDO = Part.PartClass->GetDefaultObject<AActor>();
+	PartCDO->ForEachComponent(/*bIncludeFromChildActors=*/ false, ConsiderComponent);
+
+	TArray<const UBlueprintGeneratedClass*> BlueprintClasses;
+	UBlueprintGeneratedClass::GetGeneratedClassesHierarchy(Part.PartClass, BlueprintClasses);
+	for (const UBlueprintGeneratedClass* BlueprintClass : BlueprintClasses)
+	{
+		// Don't try to resolve component overrides from child blueprints, just spawn those parts
+		if (const UInheritableComponentHandler* InheritableComponentHandler = const_cast<UBlueprintGeneratedClass*>(BlueprintClass)->GetInheritableComponentHandler())
+		{
+			TArray<UActorComponent*> OverriddenTemplates;
+			InheritableComponentHandler->GetAllTemplates(OverriddenTemplates);
+			bIsLightweight &= (OverriddenTemplates.Num() == 0);
+		}
+
+		if (const USimpleConstructionScript* ConstructionScript = BlueprintClass->SimpleConstructionScript)
+		{
+			for (const USCS_Node* Node : ConstructionScript->GetAllNodes())
+			{
+				ConsiderComponent(Node->ComponentTemplate);
+			}
+		}
+	}
+
+	return bIsLightweight ? Result : nullptr;
+}
+
+USkeletalMeshComponent* ULyraPawnComponent_CharacterParts::CreateLeaderPoseComponent(USkeletalMesh* Mesh, const USkeletalMeshComponent* Template)
+{
+	USkeletalMeshComponent* ParentMeshComponent = GetParentMeshComponent();
+	check(ParentMeshComponent);
+
+	USkeletalMeshComponent* PartComponent = NewObject<USkeletalMeshComponent>(GetOwner());
+	PartComponent->SetupAttachment(ParentMeshComponent);
+	PartComponent->SetSkeletalMesh(Mesh);
+	PartComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+
+	if (Template != nullptr)
+	{
+		for (int32 MaterialIndex = 0; MaterialIndex < Template->OverrideMaterials.Num(); ++MaterialIndex)
+		{
+			if (UMaterialInterface* Material = Template->OverrideMaterials[MaterialIndex])
+			{
+				PartComponent->SetMaterial(MaterialIndex, Material);
+			}
+		}
+	}
+
+	PartComponent->SetMasterPoseComponent(ParentMeshComponent);
+	PartComponent->RegisterComponent();
+
+	return PartComponent;
+}
+
+void ULyraPawnComponent_CharacterParts::UpdateMergedPartsMesh()
+{
+	TArray<USkeletalMesh*> SourceMeshes;
+	for (const FLyraAppliedCharacterPartEntry& Entry : CharacterPartList.Entries)
+	{
+		if (Entry.MergedMesh != nullptr)
+		{
+			SourceMeshes.Add(Entry.MergedMesh);
+		}
+	}
+
+	USkeletalMesh* DesiredMesh = nullptr;
+	if (SourceMeshes.Num() == 1)
+	{
+		// Nothing to merge
+		DesiredMesh = SourceMeshes[0];
+	}
+	else if (SourceMeshes.Num() > 1)
+	{
+		DesiredMesh = LyraCharacterParts::FindOrCreateMergedMesh(SourceMeshes);
+
+		if (DesiredMesh == nullptr)
+		{
+			// Fall back to one leader-posed component per part
+			for (FLyraAppliedCharacterPartEntry& Entry : CharacterPartList.Entries)
+			{
+				if (Entry.MergedMesh != nullptr)
+				{
+					Entry.SpawnedMeshComponent = CreateLeaderPoseComponent(Entry.MergedMesh, nullptr);
+					Entry.MergedMesh = nullptr;
+				}
+			}
+		}
+	}
+
+	if ((MergedPartsComponent == nullptr) && (DesiredMesh != nullptr))
+	{
+		MergedPartsComponent = CreateLeaderPoseComponent(DesiredMesh, nullptr);
+	}
+	else if (MergedPartsComponent != nullptr)
+	{
+		MergedPartsComponent->SetSkeletalMesh(DesiredMesh);
+		MergedPartsComponent->SetVisibility(DesiredMesh != nullptr);
+	}
+}
+
 USkeletalMeshComponent* ULyraPawnComponent_CharacterParts::GetParentMeshComponent() const
 {
 	if (AActor* OwnerActor = GetOwner())
@@ -333,6 +606,11 @@ void ULyraPawnComponent_CharacterParts::BroadcastChanged()
 		}
 	}
 
+	if (PartSpawnMode == ELyraCharacterPartSpawnMode::MergedMesh)
+	{
+		UpdateMergedPartsMesh();
+	}
+
 	// Let observers know, e.g., if they need to apply team coloring or similar
 	OnCharacterPartsChanged.Broadcast(this);
 }
@@ -11,6 +11,7 @@
 
 #include "LyraPawnComponent_CharacterParts.generated.h"
 
+class USkeletalMesh;
 class USkeletalMeshComponent;
 class UChildActorComponent;
 class ULyraPawnComponent_CharacterParts;
@@ -47,6 +48,14 @@ private:
 	// The spawned actor instance (client only)
 	UPROPERTY(NotReplicated)
 	TObjectPtr<UChildActorComponent> SpawnedComponent = nullptr;
+
+	// The leader-posed mesh component used instead of an actor (client only)
+	UPROPERTY(NotReplicated)
+	TObjectPtr<USkeletalMeshComponent> SpawnedMeshComponent = nullptr;
+
+	// The mesh of this part is part of the owner's merged part mesh (client only)
+	UPROPERTY(NotReplicated)
+	TObjectPtr<USkeletalMesh> MergedMesh = nullptr;
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -141,6 +150,12 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure=false, BlueprintCosmetic, Category=Cosmetics)
 	TArray<AActor*> GetCharacterPartActors() const;
 
+	// Gets the mesh components of the character parts that were not spawned as actors (see PartSpawnMode)
+	UFUNCTION(BlueprintCallable, BlueprintPure=false, BlueprintCosmetic, Category=Cosmetics)
+	TArray<USkeletalMeshComponent*> GetCharacterPartMeshComponents() const;
+
+	ELyraCharacterPartSpawnMode GetPartSpawnMode() const { return PartSpawnMode; }
+
 	// If the parent actor is derived from ACharacter, returns the Mesh component, otherwise nullptr
 	USkeletalMeshComponent* GetParentMeshComponent() const;
 
@@ -154,6 +169,12 @@ public:
 
 	void BroadcastChanged();
 
+	// Returns the skeletal mesh component template of a part that can be represented without spawning its actor, or nullptr if the part needs a real actor
+	const USkeletalMeshComponent* FindLightweightPartTemplate(const FLyraCharacterPart& Part) const;
+
+	// Creates a skeletal mesh component that follows the pose of the parent mesh
+	USkeletalMeshComponent* CreateLeaderPoseComponent(USkeletalMesh* Mesh, const USkeletalMeshComponent* Template);
+
 public:
 	// Delegate that will be called when the list of spawned character parts has changed
 	UPROPERTY(BlueprintAssignable, Category=Cosmetics, BlueprintCallable)
@@ -167,4 +188,14 @@ private:
 	// Rules for how to pick a body style mesh for animation to play on, based on character part cosmetics tags
 	UPROPERTY(EditAnywhere, Category=Cosmetics)
 	FLyraAnimBodyStyleSelectionSet BodyMeshes;
+
+	// How character parts are represented, the lightweight modes avoid spawning an actor per part
+	UPROPERTY(EditAnywhere, Category=Cosmetics)
+	ELyraCharacterPartSpawnMode PartSpawnMode = ELyraCharacterPartSpawnMode::ChildActors;
+
+	// Component displaying the merged meshes of the parts when using ELyraCharacterPartSpawnMode::MergedMesh
+	UPROPERTY(Transient)
+	TObjectPtr<USkeletalMeshComponent> MergedPartsComponent;
+
+	void UpdateMergedPartsMesh();
 };
@@ -13,6 +13,73 @@
 #include "AIController.h"
 #include "Kismet/GameplayStatics.h"
 #include "Character/LyraHealthComponent.h"
+#include "Character/LyraPawnData.h"
+#include "AbilitySystem/LyraAbilitySet.h"
+#include "Equipment/LyraEquipmentDefinition.h"
+#include "Engine/AssetManager.h"
+#include "BrainComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "TimerManager.h"
+
+namespace LyraBotCreation
+{
+	static float SpawnBudgetMs = 4.0f;
+	static FAutoConsoleVariableRef CVarSpawnBudgetMs(
+		TEXT("Lyra.Bots.SpawnBudgetMs"),
+		SpawnBudgetMs,
+		TEXT("Time in milliseconds that can be spent spawning queued bots each frame (at least one bot is spawned per frame)"),
+		ECVF_Default);
+
+#if WITH_SERVER_CODE
+	// Collects the soft object references of an object's properties, including the ones equal to the parent class defaults
+	class FSoftReferenceCollector : public FArchiveUObject
+	{
+	public:
+		FSoftReferenceCollector(TArray<FSoftObjectPath>& InPaths)
+			: Paths(InPaths)
+		{
+			SetIsSaving(true);
+			ArIsObjectReferenceCollector = true;
+			ArNoDelta = true;
+			ArShouldSkipBulkData = true;
+		}
+
+		virtual FArchive& operator<<(FSoftObjectPath& Value) override
+		{
+			if (!Value.IsNull())
+			{
+				Paths.AddUnique(Value);
+			}
+			return *this;
+		}
+
+		virtual FArchive& operator<<(FSoftObjectPtr& Value) override
+		{
+			FSoftObjectPath Path = Value.ToSoftObjectPath();
+			return *this << Path;
+		}
+
+		virtual FString GetArchiveName() const override { return TEXT("LyraBotCreation::FSoftReferenceCollector"); }
+
+	private:
+		TArray<FSoftObjectPath>& Paths;
+	};
+
+	// Gathers the soft references of a class default object and its default subobjects (e.g., the components of an actor)
+	static void GatherSoftReferences(UObject* DefaultObject, TArray<FSoftObjectPath>& OutPaths)
+	{
+		FSoftReferenceCollector Collector(OutPaths);
+		DefaultObject->Serialize(Collector);
+
+		TArray<UObject*> Subobjects;
+		DefaultObject->GetDefaultSubobjects(Subobjects);
+		for (UObject* Subobject : Subobjects)
+		{
+			Subobject->Serialize(Collector);
+		}
+	}
+#endif
+}
 
 ULyraBotCreationComponent::ULyraBotCreationComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -71,11 +138,156 @@ void ULyraBotCreationComponent::ServerCreateBots()
 		EffectiveBotCount = UGameplayStatics::GetIntOption(GameModeBase->OptionsString, TEXT("NumBots"), EffectiveBotCount);
 	}
 
-	// Create them
-	for (int32 Count = 0; Count < EffectiveBotCount; ++Count)
+	// Create them, spread over several frames
+	QueueBotSpawns(EffectiveBotCount);
+}
+
+void ULyraBotCreationComponent::QueueBotSpawns(int32 NumBots)
+{
+	if (NumBots <= 0)
+	{
+		return;
+	}
+
+	NumQueuedBotSpawns += NumBots;
+
+	if (!bBotAssetsPrewarmed)
+	{
+		if (!PrewarmHandle.IsValid())
+		{
+			PrewarmBotAssets();
+		}
+	}
+	else if (!bSpawnScheduled)
+	{
+		bSpawnScheduled = true;
+		GetWorld()->GetTimerManager().SetTimerForNextTick(this, &ThisClass::SpawnQueuedBots);
+	}
+}
+
+void ULyraBotCreationComponent::PrewarmBotAssets()
+{
+	// First load the equipment definitions themselves, their classes are needed to find what they reference
+	TArray<FSoftObjectPath> EquipmentPaths;
+	for (const TSoftClassPtr<ULyraEquipmentDefinition>& EquipmentDefinition : PrewarmEquipmentDefinitions)
+	{
+		if (!EquipmentDefinition.IsNull())
+		{
+			EquipmentPaths.Add(EquipmentDefinition.ToSoftObjectPath());
+		}
+	}
+
+	if (EquipmentPaths.Num() > 0)
+	{
+		PrewarmHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(EquipmentPaths, FStreamableDelegate::CreateUObject(this, &ThisClass::LoadBotSpawnDependencies));
+	}
+
+	if (!PrewarmHandle.IsValid())
+	{
+		LoadBotSpawnDependencies();
+	}
+}
+
+void ULyraBotCreationComponent::LoadBotSpawnDependencies()
+{
+	// Gather the classes a bot spawn instantiates: the pawn, its abilities, and the equipment instances and actors
+	TArray<UClass*> SpawnedClasses;
+	TArray<const ULyraAbilitySet*> AbilitySets;
+
+	ALyraGameMode* GameMode = GetGameMode<ALyraGameMode>();
+	if (const ULyraPawnData* PawnData = GameMode ? GameMode->GetPawnDataForController(nullptr) : nullptr)
 	{
+		SpawnedClasses.AddUnique(PawnData->PawnClass);
+		for (const ULyraAbilitySet* AbilitySet : PawnData->AbilitySets)
+		{
+			AbilitySets.AddUnique(AbilitySet);
+		}
+	}
+
+	for (const TSoftClassPtr<ULyraEquipmentDefinition>& EquipmentDefinition : PrewarmEquipmentDefinitions)
+	{
+		if (UClass* EquipmentClass = EquipmentDefinition.Get())
+		{
+			const ULyraEquipmentDefinition* EquipmentCDO = GetDefault<ULyraEquipmentDefinition>(EquipmentClass);
+			SpawnedClasses.AddUnique(EquipmentCDO->InstanceType);
+			for (const ULyraAbilitySet* AbilitySet : EquipmentCDO->AbilitySetsToGrant)
+			{
+				AbilitySets.AddUnique(AbilitySet);
+			}
+
+			for (const FLyraEquipmentActorToSpawn& SpawnInfo : EquipmentCDO->ActorsToSpawn)
+			{
+				SpawnedClasses.AddUnique(SpawnInfo.ActorToSpawn);
+			}
+		}
+	}
+
+	for (const ULyraAbilitySet* AbilitySet : AbilitySets)
+	{
+		if (AbilitySet)
+		{
+			AbilitySet->GetGrantedClasses(SpawnedClasses);
+		}
+	}
+
+	// Their hard references came in with the classes, the meshes, anims, etc. they only reference softly would
+	// otherwise be loaded synchronously by the first bot that needs them
+	TArray<FSoftObjectPath> SoftReferences;
+	for (UClass* Class : SpawnedClasses)
+	{
+		if (Class)
+		{
+			LyraBotCreation::GatherSoftReferences(Class->GetDefaultObject(), SoftReferences);
+		}
+	}
+
+	PrewarmHandle.Reset();
+	if (SoftReferences.Num() > 0)
+	{
+		PrewarmHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(SoftReferences, FStreamableDelegate::CreateUObject(this, &ThisClass::OnBotAssetsPrewarmed));
+	}
+
+	if (!PrewarmHandle.IsValid())
+	{
+		OnBotAssetsPrewarmed();
+	}
+}
+
+void ULyraBotCreationComponent::OnBotAssetsPrewarmed()
+{
+	if (bBotAssetsPrewarmed)
+	{
+		return;
+	}
+
+	bBotAssetsPrewarmed = true;
+
+	if (NumQueuedBotSpawns > 0)
+	{
+		bSpawnScheduled = true;
+		GetWorld()->GetTimerManager().SetTimerForNextTick(this, &ThisClass::SpawnQueuedBots);
+	}
+}
+
+void ULyraBotCreationComponent::SpawnQueuedBots()
+{
+	bSpawnScheduled = false;
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double BudgetSeconds = LyraBotCreation::SpawnBudgetMs / 1000.0;
+
+	do
+	{
+		--NumQueuedBotSpawns;
 		SpawnOneBot();
 	}
+	while ((NumQueuedBotSpawns > 0) && ((FPlatformTime::Seconds() - StartTime) < BudgetSeconds));
+
+	if (NumQueuedBotSpawns > 0)
+	{
+		bSpawnScheduled = true;
+		GetWorld()->GetTimerManager().SetTimerForNextTick(this, &ThisClass::SpawnQueuedBots);
+	}
 }
 
 FString ULyraBotCreationComponent::CreateBotName(int32 PlayerIndex)
@@ -102,7 +314,26 @@ void ULyraBotCreationComponent::SpawnOneBot()
 	SpawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 	SpawnInfo.OverrideLevel = GetComponentLevel();
 	SpawnInfo.ObjectFlags |= RF_Transient;
-	AAIController* NewController = GetWorld()->SpawnActor<AAIController>(BotControllerClass, FVector::ZeroVector, FRotator::ZeroRotator, SpawnInfo);
+
+	// Reuse the controller of a removed bot if we have one
+	AAIController* NewController = nullptr;
+	while ((NewController == nullptr) && (RecycledBotControllers.Num() > 0))
+	{
+		NewController = RecycledBotControllers.Pop();
+		if (!IsValid(NewController))
+		{
+			NewController = nullptr;
+		}
+	}
+
+	if (NewController != nullptr)
+	{
+		NewController->InitPlayerState();
+	}
+	else
+	{
+		NewController = GetWorld()->SpawnActor<AAIController>(BotControllerClass, FVector::ZeroVector, FRotator::ZeroRotator, SpawnInfo);
+	}
 
 	if (NewController != nullptr)
 	{
@@ -131,6 +362,13 @@ void ULyraBotCreationComponent::SpawnOneBot()
 
 void ULyraBotCreationComponent::RemoveOneBot()
 {
+	// Cancel a bot that hasn't spawned yet before removing one that has
+	if (NumQueuedBotSpawns > 0)
+	{
+		--NumQueuedBotSpawns;
+		return;
+	}
+
 	if (SpawnedBotList.Num() > 0)
 	{
 		// Right now this removes a random bot as they're all the same; could prefer to remove one
@@ -157,8 +395,21 @@ void ULyraBotCreationComponent::RemoveOneBot()
 				}
 			}
 
-			// Destroy the controller (will cause it to Logout, etc...)
-			BotToRemove->Destroy();
+			// Log the controller out and keep it around for the next bot, rather than destroying it
+			BotToRemove->UnPossess();
+
+			if (UBrainComponent* BrainComponent = BotToRemove->GetBrainComponent())
+			{
+				BrainComponent->StopLogic(TEXT("Bot removed"));
+			}
+
+			if (AGameModeBase* GameMode = GetGameMode<AGameModeBase>())
+			{
+				GameMode->Logout(BotToRemove);
+			}
+
+			BotToRemove->CleanupPlayerState();
+			RecycledBotControllers.Add(BotToRemove);
 		}
 	}
 }
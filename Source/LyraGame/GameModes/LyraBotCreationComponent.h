@@ -10,6 +10,8 @@
 class ULyraExperienceDefinition;
 class ULyraPawnData;
 class AAIController;
+class ULyraEquipmentDefinition;
+struct FStreamableHandle;
 
 UCLASS(Blueprintable, Abstract)
 class ULyraBotCreationComponent : public UGameStateComponent
@@ -36,17 +38,28 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category=Gameplay)
 	TArray<FString> RandomBotNames;
 
+	// Equipment the bots are expected to be given, loaded along with what it references before the first bot spawns
+	UPROPERTY(EditDefaultsOnly, Category=Gameplay)
+	TArray<TSoftClassPtr<ULyraEquipmentDefinition>> PrewarmEquipmentDefinitions;
+
 	TArray<FString> RemainingBotNames;
 
 protected:
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<AAIController>> SpawnedBotList;
 
+	// Controllers of removed bots, reused by the next bots that spawn
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AAIController>> RecycledBotControllers;
+
 #if WITH_SERVER_CODE
 public:
 	void Cheat_AddBot() { SpawnOneBot(); }
 	void Cheat_RemoveBot() { RemoveOneBot(); }
 
+	// Queues bots to be spawned over the next frames, within the Lyra.Bots.SpawnBudgetMs budget per frame
+	void QueueBotSpawns(int32 NumBots);
+
 protected:
 	virtual void ServerCreateBots();
 
@@ -54,5 +67,20 @@ protected:
 	virtual void RemoveOneBot();
 
 	FString CreateBotName(int32 PlayerIndex);
+
+private:
+	// Async loads what spawning a bot would otherwise load synchronously, then starts spawning the queued bots:
+	// the equipment definitions, then the assets softly referenced by the pawn, ability and equipment classes
+	void PrewarmBotAssets();
+	void LoadBotSpawnDependencies();
+	void OnBotAssetsPrewarmed();
+
+	void SpawnQueuedBots();
+
+	int32 NumQueuedBotSpawns = 0;
+	bool bBotAssetsPrewarmed = false;
+	bool bSpawnScheduled = false;
+
+	TSharedPtr<FStreamableHandle> PrewarmHandle;
 #endif
 };
@@ -5,6 +5,8 @@
 #include "LyraExperienceDefinition.h"
 #include "LyraExperienceActionSet.h"
 #include "LyraExperienceManager.h"
+#include "LyraExperiencePrefetchSubsystem.h"
+#include "Engine/GameInstance.h"
 #include "GameFeaturesSubsystem.h"
 #include "System/LyraAssetManager.h"
 #include "GameFeatureAction.h"
@@ -12,6 +14,7 @@
 #include "TimerManager.h"
 #include "Settings/LyraSettingsLocal.h"
 #include "LyraLogChannels.h"
+#include "Stats/StatsMisc.h"
 
 //@TODO: Async load the experience definition itself
 //@TODO: Handle failures explicitly (go into a 'completed but failed' state rather than check()-ing)
@@ -38,6 +41,13 @@ namespace LyraConsoleVariables
 		TEXT("A random amount of time between 0 and this value (in seconds) will be added as a delay of load completion of the experience (along with the fixed value lyra.chaos.ExperienceDelayLoad.MinSecs)"),
 		ECVF_Default);
 
+	static bool bLoadGameFeaturesInParallel = true;
+	static FAutoConsoleVariableRef CVarLoadGameFeaturesInParallel(
+		TEXT("lyra.Experience.LoadGameFeaturesInParallel"),
+		bLoadGameFeaturesInParallel,
+		TEXT("When true, the game feature plugins of an experience are loaded and activated while its asset bundles are still streaming in. When false, plugins wait for the bundles to finish."),
+		ECVF_Default);
+
 	float GetExperienceLoadDelayDuration()
 	{
 		return FMath::Max(0.0f, ExperienceLoadRandomDelayMin + FMath::FRand() * ExperienceLoadRandomDelayRange);
@@ -129,6 +139,19 @@ void ULyraExperienceManagerComponent::StartExperienceLoad()
 		*GetClientServerContextString(this));
 
 	LoadState = ELyraExperienceLoadState::Loading;
+	LoadStartTime = FPlatformTime::Seconds();
+	bBundleLoadComplete = false;
+	bGameFeaturePluginLoadsStarted = false;
+	BundleLoadDuration = 0.0;
+	GameFeaturePluginLoadDuration = 0.0;
+	ActionExecutionDuration = 0.0;
+
+	// The plugin list only depends on the experience definition, which is already loaded, so the plugins can be
+	// loaded and activated while the bundles stream in. Started first in case the bundles are already in memory.
+	if (LyraConsoleVariables::bLoadGameFeaturesInParallel)
+	{
+		StartGameFeaturePluginLoads();
+	}
 
 	ULyraAssetManager& AssetManager = ULyraAssetManager::Get();
 
@@ -146,21 +169,7 @@ void ULyraExperienceManagerComponent::StartExperienceLoad()
 
 	// Load assets associated with the experience
 
-	TArray<FName> BundlesToLoad;
-	BundlesToLoad.Add(FLyraBundles::Equipped);
-
-	//@TODO: Centralize this client/server stuff into the LyraAssetManager
-	const ENetMode OwnerNetMode = GetOwner()->GetNetMode();
-	const bool bLoadClient = GIsEditor || (OwnerNetMode != NM_DedicatedServer);
-	const bool bLoadServer = GIsEditor || (OwnerNetMode != NM_Client);
-	if (bLoadClient)
-	{
-		BundlesToLoad.Add(UGameFeaturesSubsystemSettings::LoadStateClient);
-	}
-	if (bLoadServer)
-	{
-		BundlesToLoad.Add(UGameFeaturesSubsystemSettings::LoadStateServer);
-	}
+	const TArray<FName> BundlesToLoad = GetBundlesToLoad(GetOwner()->GetNetMode());
 
 	const TSharedPtr<FStreamableHandle> BundleLoadHandle = AssetManager.ChangeBundleStateForPrimaryAssets(BundleAssetList.Array(), BundlesToLoad, {}, false, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
 	const TSharedPtr<FStreamableHandle> RawLoadHandle = AssetManager.LoadAssetList(RawAssetList.Array(), FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority, TEXT("StartExperienceLoad()"));
@@ -201,6 +210,26 @@ void ULyraExperienceManagerComponent::StartExperienceLoad()
 	}
 }
 
+TArray<FName> ULyraExperienceManagerComponent::GetBundlesToLoad(ENetMode NetMode)
+{
+	TArray<FName> BundlesToLoad;
+	BundlesToLoad.Add(FLyraBundles::Equipped);
+
+	//@TODO: Centralize this client/server stuff into the LyraAssetManager
+	const bool bLoadClient = GIsEditor || (NetMode != NM_DedicatedServer);
+	const bool bLoadServer = GIsEditor || (NetMode != NM_Client);
+	if (bLoadClient)
+	{
+		BundlesToLoad.Add(UGameFeaturesSubsystemSettings::LoadStateClient);
+	}
+	if (bLoadServer)
+	{
+		BundlesToLoad.Add(UGameFeaturesSubsystemSettings::LoadStateServer);
+	}
+
+	return BundlesToLoad;
+}
+
 void ULyraExperienceManagerComponent::OnExperienceLoadComplete()
 {
 	check(LoadState == ELyraExperienceLoadState::Loading);
@@ -210,6 +239,24 @@ void ULyraExperienceManagerComponent::OnExperienceLoadComplete()
 		*CurrentExperience->GetPrimaryAssetId().ToString(),
 		*GetClientServerContextString(this));
 
+	bBundleLoadComplete = true;
+	BundleLoadDuration = FPlatformTime::Seconds() - LoadStartTime;
+
+	if (!bGameFeaturePluginLoadsStarted)
+	{
+		StartGameFeaturePluginLoads();
+	}
+
+	OnExperienceLoadPhaseComplete();
+}
+
+void ULyraExperienceManagerComponent::StartGameFeaturePluginLoads()
+{
+	check(!bGameFeaturePluginLoadsStarted);
+	check(CurrentExperience != nullptr);
+
+	bGameFeaturePluginLoadsStarted = true;
+
 	// find the URLs for our GameFeaturePlugins - filtering out dupes and ones that don't have a valid mapping
 	GameFeaturePluginURLs.Reset();
 
@@ -224,7 +271,7 @@ void ULyraExperienceManagerComponent::OnExperienceLoadComplete()
 			}
 			else
 			{
-				ensureMsgf(false, TEXT("OnExperienceLoadComplete failed to find plugin URL from PluginName %s for experience %s - fix data, ignoring for this run"), *PluginName, *Context->GetPrimaryAssetId().ToString());
+				ensureMsgf(false, TEXT("StartGameFeaturePluginLoads failed to find plugin URL from PluginName %s for experience %s - fix data, ignoring for this run"), *PluginName, *Context->GetPrimaryAssetId().ToString());
 			}
 		}
 
@@ -248,20 +295,13 @@ void ULyraExperienceManagerComponent::OnExperienceLoadComplete()
 		}
 	}
 
-	// Load and activate the features	
+	// Load and activate the features
+	GameFeaturePluginLoadStartTime = FPlatformTime::Seconds();
 	NumGameFeaturePluginsLoading = GameFeaturePluginURLs.Num();
-	if (NumGameFeaturePluginsLoading > 0)
-	{
-		LoadState = ELyraExperienceLoadState::LoadingGameFeatures;
-		for (const FString& PluginURL : GameFeaturePluginURLs)
-		{
-			ULyraExperienceManager::NotifyOfPluginActivation(PluginURL);
-			UGameFeaturesSubsystem::Get().LoadAndActivateGameFeaturePlugin(PluginURL, FGameFeaturePluginLoadComplete::CreateUObject(this, &ThisClass::OnGameFeaturePluginLoadComplete));
-		}
-	}
-	else
+	for (const FString& PluginURL : GameFeaturePluginURLs)
 	{
-		OnExperienceFullLoadCompleted();
+		ULyraExperienceManager::NotifyOfPluginActivation(PluginURL);
+		UGameFeaturesSubsystem::Get().LoadAndActivateGameFeaturePlugin(PluginURL, FGameFeaturePluginLoadComplete::CreateUObject(this, &ThisClass::OnGameFeaturePluginLoadComplete));
 	}
 }
 
@@ -271,9 +311,33 @@ void ULyraExperienceManagerComponent::OnGameFeaturePluginLoadComplete(const UE::
 	NumGameFeaturePluginsLoading--;
 
 	if (NumGameFeaturePluginsLoading == 0)
+	{
+		GameFeaturePluginLoadDuration = FPlatformTime::Seconds() - GameFeaturePluginLoadStartTime;
+		OnExperienceLoadPhaseComplete();
+	}
+}
+
+void ULyraExperienceManagerComponent::OnExperienceLoadPhaseComplete()
+{
+	// Both halves report in here, only the last one to finish moves on to executing the actions
+	if ((LoadState != ELyraExperienceLoadState::Loading) && (LoadState != ELyraExperienceLoadState::LoadingGameFeatures))
+	{
+		return;
+	}
+
+	if (!bBundleLoadComplete)
+	{
+		return;
+	}
+
+	if (bGameFeaturePluginLoadsStarted && (NumGameFeaturePluginsLoading == 0))
 	{
 		OnExperienceFullLoadCompleted();
 	}
+	else
+	{
+		LoadState = ELyraExperienceLoadState::LoadingGameFeatures;
+	}
 }
 
 void ULyraExperienceManagerComponent::OnExperienceFullLoadCompleted()
@@ -298,42 +362,60 @@ void ULyraExperienceManagerComponent::OnExperienceFullLoadCompleted()
 	LoadState = ELyraExperienceLoadState::ExecutingActions;
 
 	// Execute the actions
-	FGameFeatureActivatingContext Context;
-
-	// Only apply to our specific world context if set
-	const FWorldContext* ExistingWorldContext = GEngine->GetWorldContextFromWorld(GetWorld());
-	if (ExistingWorldContext)
 	{
-		Context.SetRequiredWorldContextHandle(ExistingWorldContext->ContextHandle);
-	}
+		FScopedDurationTimer ActionExecutionTimer(ActionExecutionDuration);
 
-	auto ActivateListOfActions = [&Context](const TArray<UGameFeatureAction*>& ActionList)
-	{
-		for (UGameFeatureAction* Action : ActionList)
+		FGameFeatureActivatingContext Context;
+
+		// Only apply to our specific world context if set
+		const FWorldContext* ExistingWorldContext = GEngine->GetWorldContextFromWorld(GetWorld());
+		if (ExistingWorldContext)
 		{
-			if (Action != nullptr)
+			Context.SetRequiredWorldContextHandle(ExistingWorldContext->ContextHandle);
+		}
+
+		auto ActivateListOfActions = [&Context](const TArray<UGameFeatureAction*>& ActionList)
+		{
+			for (UGameFeatureAction* Action : ActionList)
 			{
-				//@TODO: The fact that these don't take a world are potentially problematic in client-server PIE
-				// The current behavior matches systems like gameplay tags where loading and registering apply to the entire process,
-				// but actually applying the results to actors is restricted to a specific world
-				Action->OnGameFeatureRegistering();
-				Action->OnGameFeatureLoading();
-				Action->OnGameFeatureActivating(Context);
+				if (Action != nullptr)
+				{
+					//@TODO: The fact that these don't take a world are potentially problematic in client-server PIE
+					// The current behavior matches systems like gameplay tags where loading and registering apply to the entire process,
+					// but actually applying the results to actors is restricted to a specific world
+					Action->OnGameFeatureRegistering();
+					Action->OnGameFeatureLoading();
+					Action->OnGameFeatureActivating(Context);
+				}
 			}
-		}
-	};
+		};
 
-	ActivateListOfActions(CurrentExperience->Actions);
-	for (const TObjectPtr<ULyraExperienceActionSet>& ActionSet : CurrentExperience->ActionSets)
-	{
-		if (ActionSet != nullptr)
+		ActivateListOfActions(CurrentExperience->Actions);
+		for (const TObjectPtr<ULyraExperienceActionSet>& ActionSet : CurrentExperience->ActionSets)
 		{
-			ActivateListOfActions(ActionSet->Actions);
+			if (ActionSet != nullptr)
+			{
+				ActivateListOfActions(ActionSet->Actions);
+			}
 		}
 	}
 
 	LoadState = ELyraExperienceLoadState::Loaded;
 
+	UE_LOG(LogLyraExperience, Log, TEXT("EXPERIENCE: %s loaded in %.3f s (bundles %.3f s, game feature plugins %.3f s%s, actions %.3f s, %s)"),
+		*CurrentExperience->GetPrimaryAssetId().ToString(),
+		FPlatformTime::Seconds() - LoadStartTime,
+		BundleLoadDuration,
+		GameFeaturePluginLoadDuration,
+		LyraConsoleVariables::bLoadGameFeaturesInParallel ? TEXT(" in parallel") : TEXT(""),
+		ActionExecutionDuration,
+		*GetClientServerContextString(this));
+
+	if (ULyraExperiencePrefetchSubsystem* PrefetchSubsystem = UGameInstance::GetSubsystem<ULyraExperiencePrefetchSubsystem>(GetWorld()->GetGameInstance()))
+	{
+		PrefetchSubsystem->NotifyExperienceLoaded(CurrentExperience->GetPrimaryAssetId(), GetWorld());
+	}
+
 	OnExperienceLoaded_HighPriority.Broadcast(CurrentExperience);
 	OnExperienceLoaded_HighPriority.Clear();
 
@@ -385,6 +467,7 @@ void ULyraExperienceManagerComponent::EndPlay(const EEndPlayReason::Type EndPlay
 	if (LoadState == ELyraExperienceLoadState::Loaded)
 	{
 		LoadState = ELyraExperienceLoadState::Deactivating;
+		ILoadingProcessInterface::NotifyLoadingStateChanged(this);
 
 		// Make sure we won't complete the transition prematurely if someone registers as a pauser but fires immediately
 		NumExpectedPausers = INDEX_NONE;
@@ -65,13 +65,19 @@ public:
 	// Returns true if the experience is fully loaded
 	bool IsExperienceLoaded() const;
 
+	// Returns the bundles to load for an experience, depending on whether we are a client, server or both
+	static TArray<FName> GetBundlesToLoad(ENetMode NetMode);
+
 private:
 	UFUNCTION()
 	void OnRep_CurrentExperience();
 
 	void StartExperienceLoad();
+	void StartGameFeaturePluginLoads();
 	void OnExperienceLoadComplete();
+
 	void OnGameFeaturePluginLoadComplete(const UE::GameFeatures::FResult& Result);
+	void OnExperienceLoadPhaseComplete();
 	void OnExperienceFullLoadCompleted();
 
 	void OnActionDeactivationCompleted();
@@ -86,6 +92,17 @@ private:
 	int32 NumGameFeaturePluginsLoading = 0;
 	TArray<FString> GameFeaturePluginURLs;
 
+	// The two halves of the load (bundles and game feature plugins) can run in parallel, actions wait for both
+	bool bBundleLoadComplete = false;
+	bool bGameFeaturePluginLoadsStarted = false;
+
+	// Time (in seconds) spent in each phase of the experience load
+	double LoadStartTime = 0.0;
+	double GameFeaturePluginLoadStartTime = 0.0;
+	double BundleLoadDuration = 0.0;
+	double GameFeaturePluginLoadDuration = 0.0;
+	double ActionExecutionDuration = 0.0;
+
 	int32 NumObservedPausers = 0;
 	int32 NumExpectedPausers = 0;
 
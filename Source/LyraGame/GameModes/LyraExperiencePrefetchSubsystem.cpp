@@ -0,0 +1,139 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LyraExperiencePrefetchSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "LyraExperienceDefinition.h"
+#include "LyraExperienceActionSet.h"
+#include "LyraExperienceManagerComponent.h"
+#include "System/LyraAssetManager.h"
+#include "LyraLogChannels.h"
+
+void ULyraExperiencePrefetchSubsystem::Deinitialize()
+{
+	ReleasePrefetch();
+
+	Super::Deinitialize();
+}
+
+void ULyraExperiencePrefetchSubsystem::PrefetchNextExperience(const FPrimaryAssetId& ExperienceId)
+{
+	if (ExperienceId == NextExperienceId)
+	{
+		return;
+	}
+
+	ReleasePrefetch();
+
+	const UWorld* World = GetGameInstance()->GetWorld();
+	if (!ExperienceId.IsValid() || (World == nullptr))
+	{
+		return;
+	}
+
+	NextExperienceId = ExperienceId;
+	PrefetchWorld = World;
+
+	UE_LOG(LogLyraExperience, Log, TEXT("EXPERIENCE: PrefetchNextExperience(%s, %s)"), *NextExperienceId.ToString(), *GetClientServerContextString(GetGameInstance()));
+
+	// Requested through the streamable manager rather than the asset manager's bundle state, so the handle is ours alone.
+	// The action sets are only known once the experience definition is in memory, so their bundles are requested in a second step.
+	const TArray<FName> BundlesToLoad = ULyraExperienceManagerComponent::GetBundlesToLoad(World->GetNetMode());
+	TWeakObjectPtr<ThisClass> WeakThis(this);
+	NextExperiencePrefetchHandle = ULyraAssetManager::Get().GetStreamableManager().RequestAsyncLoad(GetPrefetchPaths({ NextExperienceId }, BundlesToLoad),
+		FStreamableDelegate::CreateLambda([WeakThis, BundlesToLoad, PrefetchedId = NextExperienceId]()
+		{
+			ThisClass* StrongThis = WeakThis.Get();
+			if ((StrongThis == nullptr) || (StrongThis->NextExperienceId != PrefetchedId))
+			{
+				return;
+			}
+
+			ULyraAssetManager& AssetManager = ULyraAssetManager::Get();
+			const UClass* ExperienceClass = Cast<UClass>(AssetManager.GetPrimaryAssetPath(PrefetchedId).ResolveObject());
+			const ULyraExperienceDefinition* Experience = ExperienceClass ? GetDefault<ULyraExperienceDefinition>(ExperienceClass) : nullptr;
+			if (Experience == nullptr)
+			{
+				return;
+			}
+
+			TArray<FPrimaryAssetId> ActionSetIds;
+			for (const TObjectPtr<ULyraExperienceActionSet>& ActionSet : Experience->ActionSets)
+			{
+				if (ActionSet != nullptr)
+				{
+					ActionSetIds.AddUnique(ActionSet->GetPrimaryAssetId());
+				}
+			}
+
+			TArray<FSoftObjectPath> ActionSetPaths = GetPrefetchPaths(ActionSetIds, BundlesToLoad);
+			if (ActionSetPaths.Num() > 0)
+			{
+				// Keep the experience itself referenced by the new handle as well
+				ActionSetPaths.Add(AssetManager.GetPrimaryAssetPath(PrefetchedId));
+				StrongThis->NextExperiencePrefetchHandle = AssetManager.GetStreamableManager().RequestAsyncLoad(ActionSetPaths, FStreamableDelegate(), FStreamableManager::DefaultAsyncLoadPriority);
+			}
+		}),
+		FStreamableManager::DefaultAsyncLoadPriority);
+}
+
+void ULyraExperiencePrefetchSubsystem::NotifyExperienceLoaded(const FPrimaryAssetId& ExperienceId, const UWorld* World)
+{
+	if (!NextExperienceId.IsValid())
+	{
+		return;
+	}
+
+	if (ExperienceId == NextExperienceId)
+	{
+		// The prefetch has served its purpose, the experience itself now holds on to the bundles
+		UE_LOG(LogLyraExperience, Log, TEXT("EXPERIENCE: Prefetched %s has loaded, releasing the prefetch"), *NextExperienceId.ToString());
+		ReleasePrefetch();
+	}
+	else if (PrefetchWorld.Get() != World)
+	{
+		// We travelled since the prefetch was requested and something else loaded instead
+		UE_LOG(LogLyraExperience, Log, TEXT("EXPERIENCE: Prefetched %s but %s loaded, releasing the prefetch"), *NextExperienceId.ToString(), *ExperienceId.ToString());
+		ReleasePrefetch();
+	}
+}
+
+TArray<FSoftObjectPath> ULyraExperiencePrefetchSubsystem::GetPrefetchPaths(const TArray<FPrimaryAssetId>& AssetIds, const TArray<FName>& Bundles)
+{
+	const ULyraAssetManager& AssetManager = ULyraAssetManager::Get();
+
+	TArray<FSoftObjectPath> Paths;
+	for (const FPrimaryAssetId& AssetId : AssetIds)
+	{
+		const FSoftObjectPath AssetPath = AssetManager.GetPrimaryAssetPath(AssetId);
+		if (AssetPath.IsValid())
+		{
+			Paths.AddUnique(AssetPath);
+		}
+
+		for (const FName& Bundle : Bundles)
+		{
+			const FAssetBundleEntry BundleEntry = AssetManager.GetAssetBundleEntry(AssetId, Bundle);
+			for (const FSoftObjectPath& BundleAssetPath : BundleEntry.BundleAssets)
+			{
+				Paths.AddUnique(BundleAssetPath);
+			}
+		}
+	}
+
+	return Paths;
+}
+
+void ULyraExperiencePrefetchSubsystem::ReleasePrefetch()
+{
+	// Only cancel our own handle, the asset manager's handles for the experience can belong to an experience manager
+	// (e.g., another world in multi-client PIE) or to a load that has just started
+	if (NextExperiencePrefetchHandle.IsValid())
+	{
+		NextExperiencePrefetchHandle->CancelHandle();
+		NextExperiencePrefetchHandle.Reset();
+	}
+
+	NextExperienceId = FPrimaryAssetId();
+	PrefetchWorld.Reset();
+}
@@ -0,0 +1,48 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "LyraExperiencePrefetchSubsystem.generated.h"
+
+struct FStreamableHandle;
+
+/**
+ * Streams in the bundles of the experience expected to run next (e.g., the next playlist entry) during the current
+ * match. Lives on the game instance so the prefetched assets are still referenced when the travel to the next map
+ * garbage collects the current world, and releases them once the next experience has finished loading.
+ */
+UCLASS()
+class LYRAGAME_API ULyraExperiencePrefetchSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~USubsystem interface
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	// Starts streaming in the bundles of ExperienceId without blocking anything, so the following experience load finds
+	// most of its assets already in memory. Passing an invalid id releases the previous prefetch.
+	void PrefetchNextExperience(const FPrimaryAssetId& ExperienceId);
+
+	// Returns the experience being prefetched, if any
+	FPrimaryAssetId GetPrefetchedExperienceId() const { return NextExperienceId; }
+
+	// Called by the experience manager once an experience has fully loaded. Releases the prefetch if it was for that
+	// experience, or if it was requested in an earlier world and a different experience ended up loading.
+	void NotifyExperienceLoaded(const FPrimaryAssetId& ExperienceId, const UWorld* World);
+
+private:
+	// Returns the primary asset paths and bundle contents of the assets, to request with our own streamable handle
+	static TArray<FSoftObjectPath> GetPrefetchPaths(const TArray<FPrimaryAssetId>& AssetIds, const TArray<FName>& Bundles);
+
+	void ReleasePrefetch();
+
+private:
+	// The experience currently being prefetched, the world that asked for it and the handle keeping its bundles in memory
+	FPrimaryAssetId NextExperienceId;
+	TWeakObjectPtr<const UWorld> PrefetchWorld;
+	TSharedPtr<FStreamableHandle> NextExperiencePrefetchHandle;
+};
@@ -6,8 +6,8 @@
 #include "GameModes/LyraExperienceManagerComponent.h"
 #include "GameFramework/PlayerState.h"
 #include "GameFramework/GameplayMessageSubsystem.h"
-
-extern ENGINE_API float GAverageFPS;
+#include "Player/LyraPlayerController.h"
+#include "Misc/App.h"
 
 
 ALyraGameState::ALyraGameState(const FObjectInitializer& ObjectInitializer)
@@ -21,8 +21,6 @@ ALyraGameState::ALyraGameState(const FObjectInitializer& ObjectInitializer)
 	AbilitySystemComponent->SetReplicationMode(EGameplayEffectReplicationMode::Mixed);
 
 	ExperienceManagerComponent = CreateDefaultSubobject<ULyraExperienceManagerComponent>(TEXT("ExperienceManagerComponent"));
-
-	ServerFPS = 0.0f;
 }
 
 void ALyraGameState::PreInitializeComponents()
@@ -45,6 +43,9 @@ UAbilitySystemComponent* ALyraGameState::GetAbilitySystemComponent() const
 
 void ALyraGameState::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	ServerTelemetryCollector.Reset();
+	ServerTelemetrySubscribers.Reset();
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -64,7 +65,7 @@ void ALyraGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLi
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(ThisClass, ServerFPS);
+	DOREPLIFETIME(ThisClass, ServerTelemetry);
 }
 
 void ALyraGameState::Tick(float DeltaSeconds)
@@ -73,8 +74,66 @@ void ALyraGameState::Tick(float DeltaSeconds)
 
 	if (GetLocalRole() == ROLE_Authority)
 	{
-		ServerFPS = GAverageFPS;
+		UpdateServerTelemetry();
+	}
+}
+
+void ALyraGameState::UpdateServerTelemetry()
+{
+	if (!ServerTelemetryCollector)
+	{
+		ServerTelemetryCollector = MakeUnique<FLyraServerTelemetryCollector>(/*bWriteCSV=*/ GetNetMode() == NM_DedicatedServer);
+	}
+
+	// Use the undilated frame time, this is about server performance rather than game time
+	FLyraServerTelemetry NewTelemetry;
+	if (!ServerTelemetryCollector->Tick(FApp::GetDeltaTime(), GetWorld(), PlayerArray.Num(), NewTelemetry))
+	{
+		return;
+	}
+
+	LatestServerTelemetry = NewTelemetry;
+
+	if (NewTelemetry.HasMeaningfulChange(ServerTelemetry))
+	{
+		ServerTelemetry = NewTelemetry;
+	}
+
+	for (int32 Index = ServerTelemetrySubscribers.Num() - 1; Index >= 0; --Index)
+	{
+		if (ALyraPlayerController* Subscriber = ServerTelemetrySubscribers[Index].Get())
+		{
+			Subscriber->ClientReceiveServerTelemetry(NewTelemetry);
+		}
+		else
+		{
+			ServerTelemetrySubscribers.RemoveAtSwap(Index);
+		}
+	}
+}
+
+void ALyraGameState::SetServerTelemetrySubscription(ALyraPlayerController* PlayerController, bool bSubscribed)
+{
+	check(HasAuthority());
+
+	if (bSubscribed)
+	{
+		ServerTelemetrySubscribers.AddUnique(PlayerController);
 	}
+	else
+	{
+		ServerTelemetrySubscribers.RemoveSwap(PlayerController);
+	}
+}
+
+void ALyraGameState::ReceiveServerTelemetry(const FLyraServerTelemetry& Telemetry)
+{
+	LatestServerTelemetry = Telemetry;
+}
+
+void ALyraGameState::OnRep_ServerTelemetry()
+{
+	LatestServerTelemetry = ServerTelemetry;
 }
 
 void ALyraGameState::MulticastMessageToClients_Implementation(const FLyraVerbMessage Message)
@@ -6,12 +6,14 @@
 #include "ModularGameState.h"
 #include "AbilitySystemInterface.h"
 #include "Messages/LyraVerbMessage.h"
+#include "Performance/LyraServerTelemetry.h"
 
 #include "LyraGameState.generated.h"
 
 class ULyraExperienceManagerComponent;
 class ULyraAbilitySystemComponent;
 class UAbilitySystemComponent;
+class ALyraPlayerController;
 
 /**
  * ALyraGameState
@@ -27,7 +29,16 @@ public:
 
 	ALyraGameState(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
-	float GetServerFPS() const { return ServerFPS; }
+	float GetServerFPS() const { return LatestServerTelemetry.GetAverageFPS(); }
+
+	// Returns the most recent server performance telemetry known locally
+	const FLyraServerTelemetry& GetServerTelemetry() const { return LatestServerTelemetry; }
+
+	// Adds or removes a player that receives every telemetry sample rather than only meaningful changes (server only)
+	void SetServerTelemetrySubscription(ALyraPlayerController* PlayerController, bool bSubscribed);
+
+	// Called on subscribed clients when the server sends them a telemetry sample
+	void ReceiveServerTelemetry(const FLyraServerTelemetry& Telemetry);
 
 	//~AActor interface
 	virtual void PreInitializeComponents() override;
@@ -70,7 +81,21 @@ protected:
 
 	virtual void Tick(float DeltaSeconds) override;
 
+	void UpdateServerTelemetry();
+
+	UFUNCTION()
+	void OnRep_ServerTelemetry();
+
 protected:
-	UPROPERTY(Replicated)
-	float ServerFPS;
+	// Server telemetry replicated to every client, only updated when it changes meaningfully
+	UPROPERTY(ReplicatedUsing=OnRep_ServerTelemetry)
+	FLyraServerTelemetry ServerTelemetry;
+
+	// Latest telemetry sample, which may be newer than ServerTelemetry on the server and on subscribed clients
+	FLyraServerTelemetry LatestServerTelemetry;
+
+	// Players that receive every telemetry sample
+	TArray<TWeakObjectPtr<ALyraPlayerController>> ServerTelemetrySubscribers;
+
+	TUniquePtr<FLyraServerTelemetryCollector> ServerTelemetryCollector;
 };
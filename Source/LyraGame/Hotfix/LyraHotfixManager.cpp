@@ -4,7 +4,6 @@
 #include "Misc/AES.h"
 #include "Misc/Base64.h"
 #include "Misc/CoreDelegates.h"
-#include "UObject/UObjectIterator.h"
 #include "Engine/NetDriver.h"
 #include "Engine/GameEngine.h"
 #include "Misc/FileHelper.h"
@@ -14,9 +13,50 @@
 #include "Settings/LyraSettingsLocal.h"
 #include "TimerManager.h"
 #include "HAL/MemoryMisc.h"
+#include "HAL/IConsoleManager.h"
+#include "Engine/Engine.h"
+#include "Misc/ConfigCacheIni.h"
 
 int32 ULyraHotfixManager::GameHotfixCounter = 0;
 
+namespace LyraHotfix
+{
+	static const TCHAR* AssetHotfixSectionName = TEXT("AssetHotfix");
+
+	static float PatchAssetsBudgetMs = 2.0f;
+	static FAutoConsoleVariableRef CVarPatchAssetsBudgetMs(
+		TEXT("Lyra.Hotfix.PatchAssetsBudgetMs"),
+		PatchAssetsBudgetMs,
+		TEXT("Time budget per frame (in ms) for patching assets from changed [AssetHotfix] lines, at least one asset is patched each frame"),
+		ECVF_Default);
+
+#if !UE_BUILD_SHIPPING
+	static FAutoConsoleCommand CmdApplyLocalIni(
+		TEXT("Lyra.Hotfix.ApplyLocalIni"),
+		TEXT("Usage: Lyra.Hotfix.ApplyLocalIni <FilePath>. Applies a local ini file (named like the file it hotfixes, e.g. DefaultGame.ini) as if it had been downloaded as a hotfix"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(
+			[](const TArray<FString>& Params)
+			{
+				ULyraHotfixManager* HotfixManager = Cast<ULyraHotfixManager>(UOnlineHotfixManager::Get(nullptr));
+				if ((HotfixManager != nullptr) && (Params.Num() > 0))
+				{
+					HotfixManager->ApplyLocalIniHotfix(Params[0]);
+				}
+			}));
+#endif // !UE_BUILD_SHIPPING
+
+	// [AssetHotfix] values look like AssetPath;Operation;...
+	static FString GetAssetPathFromHotfixLine(const FString& Value)
+	{
+		FString AssetPath;
+		if (!Value.Split(TEXT(";"), &AssetPath, nullptr))
+		{
+			AssetPath = Value;
+		}
+		return AssetPath.TrimStartAndEnd();
+	}
+}
+
 ULyraHotfixManager::ULyraHotfixManager()
 {
 #if !UE_BUILD_SHIPPING
@@ -33,14 +73,22 @@ void ULyraHotfixManager::Init()
 
 void ULyraHotfixManager::OnHotfixCompleted(EHotfixResult HotfixResult)
 {
-	// Reload DDoS detection config for all live Net Drivers (mirrors RepGraph code)
-	for (TObjectIterator<UNetDriver> It; It; ++It)
+	// Reload DDoS detection config for all live server Net Drivers, it only comes from the engine ini
+	if (bHasPendingEngineHotfix && (GEngine != nullptr))
 	{
-		if (It->IsServer())
+		bHasPendingEngineHotfix = false;
+
+		for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
 		{
-			UE_LOG(LogHotfixManager, Log, TEXT("Reloading DDoS detection settings for NetDriver: %s"), *It->GetName());
+			for (const FNamedNetDriver& NamedNetDriver : WorldContext.ActiveNetDrivers)
+			{
+				if ((NamedNetDriver.NetDriver != nullptr) && NamedNetDriver.NetDriver->IsServer())
+				{
+					UE_LOG(LogHotfixManager, Log, TEXT("Reloading DDoS detection settings for NetDriver: %s"), *NamedNetDriver.NetDriver->GetName());
 
-			It->DDoS.InitConfig();
+					NamedNetDriver.NetDriver->DDoS.InitConfig();
+				}
+			}
 		}
 	}
 
@@ -64,6 +112,11 @@ ULyraHotfixManager::~ULyraHotfixManager()
 {
 	ClearOnHotfixCompleteDelegate_Handle(HotfixCompleteDelegateHandle);
 
+	if (PatchPendingAssetsHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PatchPendingAssetsHandle);
+	}
+
 #if !UE_BUILD_SHIPPING
 	FCoreDelegates::OnGetOnScreenMessages.Remove(OnScreenMessageHandle);
 #endif // !UE_BUILD_SHIPPING
@@ -98,6 +151,11 @@ bool ULyraHotfixManager::WantsHotfixProcessing(const FCloudFileHeader& FileHeade
 
 bool ULyraHotfixManager::HotfixIniFile(const FString& FileName, const FString& IniData)
 {
+	if (FileName.EndsWith(TEXT("ENGINE.INI"), ESearchCase::IgnoreCase))
+	{
+		bHasPendingEngineHotfix = true;
+	}
+
 	if (!bHasPendingDeviceProfileHotfix && FileName.EndsWith(TEXT("DEVICEPROFILES.INI"), ESearchCase::IgnoreCase))
 	{
 		FConfigFile DeviceProfileHotfixConfig;
@@ -155,13 +213,121 @@ void ULyraHotfixManager::PatchAssetsFromIniFiles()
 	FSharedMemoryTracker::PrintMemoryDiff(TEXT("Start - PatchAssetsFromIniFiles"));
 #endif
 
-	Super::PatchAssetsFromIniFiles();
+	// Rather than re-patching every asset listed in [AssetHotfix] each time, diff the section against what we
+	// already applied and only queue up the assets that have a new or changed line (or weren't loaded last time).
+	// A changed asset gets all of its current lines reapplied in their original order, since a TableUpdate line
+	// replaces the whole table and would otherwise drop the RowUpdate lines after it that didn't change.
+	PendingAssetHotfixes.Reset();
+
+	TSet<FString> CurrentLines;
+	if (const FConfigSection* AssetHotfixSection = GConfig->GetSectionPrivate(LyraHotfix::AssetHotfixSectionName, false, true, GGameIni))
+	{
+		TArray<FPendingAssetHotfix> AssetHotfixes;
+		TArray<bool> AssetHasChanges;
+
+		for (const auto& KVP : *AssetHotfixSection)
+		{
+			const FString& Value = KVP.Value.GetValue();
+			const FString LineKey = KVP.Key.ToString() + TEXT("=") + Value;
+			CurrentLines.Add(LineKey);
+
+			const FString AssetPath = LyraHotfix::GetAssetPathFromHotfixLine(Value);
+
+			int32 AssetIndex = AssetHotfixes.IndexOfByPredicate([&AssetPath](const FPendingAssetHotfix& Pending) { return Pending.AssetPath == AssetPath; });
+			if (AssetIndex == INDEX_NONE)
+			{
+				AssetIndex = AssetHotfixes.AddDefaulted();
+				AssetHotfixes[AssetIndex].AssetPath = AssetPath;
+				AssetHasChanges.Add(false);
+			}
+
+			AssetHotfixes[AssetIndex].Lines.Emplace(KVP.Key, Value);
+			AssetHasChanges[AssetIndex] |= !AppliedAssetHotfixLines.Contains(LineKey);
+		}
+
+		for (int32 AssetIndex = 0; AssetIndex < AssetHotfixes.Num(); ++AssetIndex)
+		{
+			if (AssetHasChanges[AssetIndex])
+			{
+				PendingAssetHotfixes.Add(MoveTemp(AssetHotfixes[AssetIndex]));
+			}
+		}
+	}
+
+	// Forget lines that were removed, so they get applied again if they ever come back
+	AppliedAssetHotfixLines = AppliedAssetHotfixLines.Intersect(CurrentLines);
+
+	UE_LOG(LogHotfixManager, Display, TEXT("PatchAssetsFromIniFiles: %d asset(s) with new or changed hotfix lines, %d applied line(s) unchanged"), PendingAssetHotfixes.Num(), AppliedAssetHotfixLines.Num());
+
+	// Patch what fits in this frame right away, and spread the rest over the following frames
+	if (PatchPendingAssets(0.0f) && !PatchPendingAssetsHandle.IsValid())
+	{
+		PatchPendingAssetsHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::PatchPendingAssets));
+	}
 
 #if ENABLE_SHARED_MEMORY_TRACKER
 	FSharedMemoryTracker::PrintMemoryDiff(TEXT("End - PatchAssetsFromIniFiles"));
 #endif
 }
 
+bool ULyraHotfixManager::PatchPendingAssets(float DeltaTime)
+{
+	FConfigSection* AssetHotfixSection = (PendingAssetHotfixes.Num() > 0) ? GConfig->GetSectionPrivate(LyraHotfix::AssetHotfixSectionName, false, false, GGameIni) : nullptr;
+	if (AssetHotfixSection == nullptr)
+	{
+		PendingAssetHotfixes.Reset();
+		PatchPendingAssetsHandle.Reset();
+		return false;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// The base implementation patches everything in the section, so point it at just the lines for one asset at a time
+	FConfigSection FullSection = *AssetHotfixSection;
+
+	int32 NumPatched = 0;
+	while (NumPatched < PendingAssetHotfixes.Num())
+	{
+		const FPendingAssetHotfix& PendingHotfix = PendingAssetHotfixes[NumPatched++];
+
+		AssetHotfixSection->Empty(PendingHotfix.Lines.Num());
+		for (const TPair<FName, FString>& Line : PendingHotfix.Lines)
+		{
+			AssetHotfixSection->Add(Line.Key, FConfigValue(Line.Value));
+		}
+
+		Super::PatchAssetsFromIniFiles();
+
+		// Only consider the lines applied if the asset was actually there to patch, otherwise try again
+		// next time (e.g., when the plugin that contains it gets loaded)
+		if (UObject* PatchedAsset = FSoftObjectPath(PendingHotfix.AssetPath).ResolveObject())
+		{
+			PatchedAssets.AddUnique(PatchedAsset);
+			for (const TPair<FName, FString>& Line : PendingHotfix.Lines)
+			{
+				AppliedAssetHotfixLines.Add(Line.Key.ToString() + TEXT("=") + Line.Value);
+			}
+		}
+
+		if ((FPlatformTime::Seconds() - StartTime) * 1000.0 >= LyraHotfix::PatchAssetsBudgetMs)
+		{
+			break;
+		}
+	}
+
+	*AssetHotfixSection = MoveTemp(FullSection);
+	PendingAssetHotfixes.RemoveAt(0, NumPatched);
+
+	if (PendingAssetHotfixes.Num() > 0)
+	{
+		UE_LOG(LogHotfixManager, Verbose, TEXT("Patched %d asset(s) from hotfix this frame, %d remaining"), NumPatched, PendingAssetHotfixes.Num());
+		return true;
+	}
+
+	PatchPendingAssetsHandle.Reset();
+	return false;
+}
+
 void ULyraHotfixManager::OnHotfixAvailablityCheck(const TArray<FCloudFileHeader>& PendingChangedFiles, const TArray<FCloudFileHeader>& PendingRemoveFiles)
 {
 	bool bNewPendingGameHotfix = false;
@@ -214,6 +380,35 @@ void ULyraHotfixManager::RequestPatchAssetsFromIniFiles()
 	}
 }
 
+#if !UE_BUILD_SHIPPING
+bool ULyraHotfixManager::ApplyLocalIniHotfix(const FString& FilePath)
+{
+	FString IniData;
+	if (!FFileHelper::LoadFileToString(IniData, *FilePath))
+	{
+		UE_LOG(LogHotfixManager, Error, TEXT("ApplyLocalIniHotfix: failed to read '%s'"), *FilePath);
+		return false;
+	}
+
+	const FString FileName = FPaths::GetCleanFilename(FilePath);
+	if (!HotfixIniFile(FileName, IniData))
+	{
+		UE_LOG(LogHotfixManager, Error, TEXT("ApplyLocalIniHotfix: failed to apply '%s'"), *FilePath);
+		return false;
+	}
+
+	UE_LOG(LogHotfixManager, Display, TEXT("ApplyLocalIniHotfix: applied '%s'"), *FilePath);
+
+	if (FileName.EndsWith(TEXT("GAME.INI"), ESearchCase::IgnoreCase))
+	{
+		PatchAssetsFromIniFiles();
+	}
+
+	OnHotfixCompleted(EHotfixResult::Success);
+	return true;
+}
+#endif // !UE_BUILD_SHIPPING
+
 void ULyraHotfixManager::StartHotfixProcess()
 {
 	if (GIsEditor)
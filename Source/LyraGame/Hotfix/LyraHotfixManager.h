@@ -28,6 +28,11 @@ public:
 
 	void RequestPatchAssetsFromIniFiles();
 
+#if !UE_BUILD_SHIPPING
+	/** Applies an ini file from local disk as if it had just been downloaded as a hotfix, so the patching path can be exercised offline */
+	bool ApplyLocalIniHotfix(const FString& FilePath);
+#endif // !UE_BUILD_SHIPPING
+
 protected:
 	void OnHotfixCompleted(EHotfixResult HotfixResult);
 
@@ -65,12 +70,32 @@ private:
 
 	void Init() override;
 
+	/** Patches the queued asset hotfix lines until the frame budget runs out, returns true while there is more to patch */
+	bool PatchPendingAssets(float DeltaTime);
+
 private:
 	FTSTicker::FDelegateHandle RequestPatchAssetsHandle;
 	FDelegateHandle HotfixCompleteDelegateHandle;
 
+	/** Assets waiting to be patched, each with all of its current [AssetHotfix] lines in section order */
+	struct FPendingAssetHotfix
+	{
+		FString AssetPath;
+		TArray<TPair<FName, FString>> Lines;
+	};
+	TArray<FPendingAssetHotfix> PendingAssetHotfixes;
+	FTSTicker::FDelegateHandle PatchPendingAssetsHandle;
+
+	/** The [AssetHotfix] lines (Class=Value) that have already been applied to a loaded asset */
+	TSet<FString> AppliedAssetHotfixLines;
+
+	/** Assets we have patched, kept alive so they don't get reloaded from disk without the patch */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UObject>> PatchedAssets;
+
 	bool bHasPendingGameHotfix = false;
 	bool bHasPendingDeviceProfileHotfix = false;
+	bool bHasPendingEngineHotfix = false;
 
 	static int32 GameHotfixCounter;
 };
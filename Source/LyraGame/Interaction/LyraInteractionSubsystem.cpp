@@ -0,0 +1,331 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LyraInteractionSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/PrimitiveComponent.h"
+#include "Physics/LyraCollisionChannels.h"
+#include "TimerManager.h"
+#include "Interaction/IInteractableTarget.h"
+#include "Interaction/InteractionStatics.h"
+#include "Interaction/Tasks/AbilityTask_GrantNearbyInteraction.h"
+
+namespace LyraInteraction
+{
+	static bool bUseSpatialGrid = true;
+	static FAutoConsoleVariableRef CVarUseSpatialGrid(
+		TEXT("Lyra.Interaction.UseSpatialGrid"),
+		bUseSpatialGrid,
+		TEXT("When true, nearby interaction scans are resolved by ULyraInteractionSubsystem's grid in one pass, otherwise each scanner runs its own overlap query."),
+		ECVF_Default);
+
+	static float GridCellSize = 1000.0f;
+	static FAutoConsoleVariableRef CVarGridCellSize(
+		TEXT("Lyra.Interaction.GridCellSize"),
+		GridCellSize,
+		TEXT("Size (in cm) of the cells of the interaction grid, should be roughly the size of the largest scan range."),
+		ECVF_Default);
+}
+
+//////////////////////////////////////////////////////////////////////
+// ULyraInteractionSubsystem
+
+ULyraInteractionSubsystem::ULyraInteractionSubsystem()
+{
+}
+
+void ULyraInteractionSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(ScanTimerHandle);
+	}
+
+	Scanners.Reset();
+	Entries.Reset();
+	EntryIndexByObject.Reset();
+	Cells.Reset();
+
+	Super::Deinitialize();
+}
+
+bool ULyraInteractionSubsystem::IsSpatialGridEnabled()
+{
+	return LyraInteraction::bUseSpatialGrid;
+}
+
+void ULyraInteractionSubsystem::RegisterInteractableTarget(TScriptInterface<IInteractableTarget> Target)
+{
+	UObject* TargetObject = Target.GetObject();
+	if ((TargetObject == nullptr) || EntryIndexByObject.Contains(TargetObject))
+	{
+		return;
+	}
+
+	FInteractableEntry NewEntry;
+	NewEntry.Target = Target;
+	NewEntry.WeakObject = TargetObject;
+	NewEntry.ObjectKey = TargetObject;
+
+	const int32 EntryIndex = Entries.Add(MoveTemp(NewEntry));
+	EntryIndexByObject.Add(TargetObject, EntryIndex);
+
+	RefreshEntry(EntryIndex);
+	AddToCell(EntryIndex);
+}
+
+void ULyraInteractionSubsystem::UnregisterInteractableTarget(TScriptInterface<IInteractableTarget> Target)
+{
+	int32 EntryIndex = INDEX_NONE;
+	if (EntryIndexByObject.RemoveAndCopyValue(Target.GetObject(), EntryIndex))
+	{
+		RemoveFromCell(EntryIndex);
+		Entries.RemoveAt(EntryIndex);
+	}
+}
+
+void ULyraInteractionSubsystem::RegisterScanner(UAbilityTask_GrantNearbyInteraction* Scanner)
+{
+	check(Scanner);
+
+	FScannerEntry& NewEntry = Scanners.AddDefaulted_GetRef();
+	NewEntry.WeakScanner = Scanner;
+	NewEntry.NextScanTime = GetWorld()->GetTimeSeconds();
+
+	UpdateScanTimer();
+}
+
+void ULyraInteractionSubsystem::UnregisterScanner(UAbilityTask_GrantNearbyInteraction* Scanner)
+{
+	Scanners.RemoveAllSwap([Scanner](const FScannerEntry& Entry) { return !Entry.WeakScanner.IsValid() || (Entry.WeakScanner.Get() == Scanner); });
+
+	UpdateScanTimer();
+}
+
+void ULyraInteractionSubsystem::QueryInteractableTargets(const FVector& Location, float Range, TArray<TScriptInterface<IInteractableTarget>>& OutTargets) const
+{
+	if (Entries.Num() == 0)
+	{
+		return;
+	}
+
+	const float SearchRadius = Range + MaxEntryRadius;
+	const FIntPoint MinCell = GetCell(Location - FVector(SearchRadius));
+	const FIntPoint MaxCell = GetCell(Location + FVector(SearchRadius));
+
+	for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+	{
+		for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+		{
+			const TArray<int32>* CellEntries = Cells.Find(FIntPoint(CellX, CellY));
+			if (CellEntries == nullptr)
+			{
+				continue;
+			}
+
+			for (const int32 EntryIndex : *CellEntries)
+			{
+				const FInteractableEntry& Entry = Entries[EntryIndex];
+				if (Entry.WeakObject.IsValid() && (FVector::DistSquared(Location, Entry.Location) <= FMath::Square(Range + Entry.Radius)) && RespondsToInteractionChannel(Entry))
+				{
+					OutTargets.AddUnique(Entry.Target);
+				}
+			}
+		}
+	}
+}
+
+FIntPoint ULyraInteractionSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / GridCellSize), FMath::FloorToInt(Location.Y / GridCellSize));
+}
+
+void ULyraInteractionSubsystem::AddToCell(int32 EntryIndex)
+{
+	FInteractableEntry& Entry = Entries[EntryIndex];
+	if (GridCellSize <= 0.0f)
+	{
+		GridCellSize = FMath::Max(LyraInteraction::GridCellSize, 1.0f);
+	}
+
+	Entry.Cell = GetCell(Entry.Location);
+	Cells.FindOrAdd(Entry.Cell).Add(EntryIndex);
+	MaxEntryRadius = FMath::Max(MaxEntryRadius, Entry.Radius);
+}
+
+void ULyraInteractionSubsystem::RemoveFromCell(int32 EntryIndex)
+{
+	const FIntPoint Cell = Entries[EntryIndex].Cell;
+	if (TArray<int32>* CellEntries = Cells.Find(Cell))
+	{
+		CellEntries->RemoveSingleSwap(EntryIndex);
+		if (CellEntries->Num() == 0)
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
+
+bool ULyraInteractionSubsystem::RefreshEntry(int32 EntryIndex)
+{
+	FInteractableEntry& Entry = Entries[EntryIndex];
+	if (AActor* Actor = UInteractionStatics::GetActorFromInteractableTarget(Entry.Target))
+	{
+		const FVector Location = Actor->GetActorLocation();
+		if (Entry.bHasBounds && (Location == Entry.Location))
+		{
+			return false;
+		}
+
+		FVector Origin;
+		FVector Extent;
+		Actor->GetActorBounds(/*bOnlyCollidingComponents=*/ true, Origin, Extent);
+		Entry.Location = Location;
+		Entry.Radius = FVector::Dist(Entry.Location, Origin) + Extent.Size();
+		Entry.bHasBounds = true;
+
+		// Queries rely on this covering every target, including ones that grew without changing cell
+		MaxEntryRadius = FMath::Max(MaxEntryRadius, Entry.Radius);
+		return true;
+	}
+
+	return false;
+}
+
+bool ULyraInteractionSubsystem::RespondsToInteractionChannel(const FInteractableEntry& Entry)
+{
+	auto RespondsToChannel = [](const UPrimitiveComponent* Component)
+	{
+		return Component->IsQueryCollisionEnabled() && (Component->GetCollisionResponseToChannel(Lyra_TraceChannel_Interaction) != ECR_Ignore);
+	};
+
+	// An interactable actor is found through any of its components, an interactable component only through itself
+	const UObject* TargetObject = Entry.WeakObject.Get();
+	if (const UPrimitiveComponent* Component = Cast<UPrimitiveComponent>(TargetObject))
+	{
+		return RespondsToChannel(Component);
+	}
+	else if (const AActor* Actor = Cast<AActor>(TargetObject))
+	{
+		TInlineComponentArray<UPrimitiveComponent*> Components(Actor);
+		for (const UPrimitiveComponent* ActorComponent : Components)
+		{
+			if (ActorComponent->IsRegistered() && RespondsToChannel(ActorComponent))
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+void ULyraInteractionSubsystem::RebuildGrid()
+{
+	GridCellSize = FMath::Max(LyraInteraction::GridCellSize, 1.0f);
+	MaxEntryRadius = 0.0f;
+	Cells.Reset();
+
+	for (auto EntryIt = Entries.CreateIterator(); EntryIt; ++EntryIt)
+	{
+		AddToCell(EntryIt.GetIndex());
+	}
+}
+
+void ULyraInteractionSubsystem::UpdateScanTimer()
+{
+	float MinScanRate = 0.0f;
+	for (const FScannerEntry& Entry : Scanners)
+	{
+		if (const UAbilityTask_GrantNearbyInteraction* Scanner = Entry.WeakScanner.Get())
+		{
+			const float ScanRate = Scanner->GetInteractionScanRate();
+			MinScanRate = (MinScanRate > 0.0f) ? FMath::Min(MinScanRate, ScanRate) : ScanRate;
+		}
+	}
+
+	if (MinScanRate == ScanTimerRate)
+	{
+		return;
+	}
+
+	ScanTimerRate = MinScanRate;
+
+	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+	if (ScanTimerRate > 0.0f)
+	{
+		TimerManager.SetTimer(ScanTimerHandle, this, &ThisClass::ScanAll, ScanTimerRate, true);
+	}
+	else
+	{
+		TimerManager.ClearTimer(ScanTimerHandle);
+	}
+}
+
+void ULyraInteractionSubsystem::ScanAll()
+{
+	const double CurrentTime = GetWorld()->GetTimeSeconds();
+
+	// Gather the due scanners up front, their callbacks can end abilities and unregister scanners from under us
+	TArray<TWeakObjectPtr<UAbilityTask_GrantNearbyInteraction>, TInlineAllocator<16>> DueScanners;
+	for (int32 ScannerIndex = Scanners.Num() - 1; ScannerIndex >= 0; --ScannerIndex)
+	{
+		FScannerEntry& Entry = Scanners[ScannerIndex];
+		const UAbilityTask_GrantNearbyInteraction* Scanner = Entry.WeakScanner.Get();
+		if (Scanner == nullptr)
+		{
+			Scanners.RemoveAtSwap(ScannerIndex);
+			continue;
+		}
+
+		if (CurrentTime < Entry.NextScanTime)
+		{
+			continue;
+		}
+		Entry.NextScanTime = CurrentTime + Scanner->GetInteractionScanRate();
+		DueScanners.Add(Entry.WeakScanner);
+	}
+
+	if (DueScanners.Num() == 0)
+	{
+		return;
+	}
+
+	if (GridCellSize != FMath::Max(LyraInteraction::GridCellSize, 1.0f))
+	{
+		RebuildGrid();
+	}
+
+	// Targets can move (e.g., dropped pickups), re-bucket the ones that did and drop the ones that went away
+	for (auto EntryIt = Entries.CreateIterator(); EntryIt; ++EntryIt)
+	{
+		const int32 EntryIndex = EntryIt.GetIndex();
+		if (!EntryIt->WeakObject.IsValid())
+		{
+			RemoveFromCell(EntryIndex);
+			EntryIndexByObject.Remove(EntryIt->ObjectKey);
+			EntryIt.RemoveCurrent();
+			continue;
+		}
+
+		if (RefreshEntry(EntryIndex) && (GetCell(EntryIt->Location) != EntryIt->Cell))
+		{
+			RemoveFromCell(EntryIndex);
+			AddToCell(EntryIndex);
+		}
+	}
+
+	TArray<TScriptInterface<IInteractableTarget>> NearbyTargets;
+	for (const TWeakObjectPtr<UAbilityTask_GrantNearbyInteraction>& WeakScanner : DueScanners)
+	{
+		// Ended tasks are marked as garbage, so this also skips scanners an earlier callback shut down
+		UAbilityTask_GrantNearbyInteraction* Scanner = WeakScanner.Get();
+		const AActor* Avatar = Scanner ? Scanner->GetAvatarActor() : nullptr;
+		if (Avatar)
+		{
+			NearbyTargets.Reset();
+			QueryInteractableTargets(Avatar->GetActorLocation(), Scanner->GetInteractionScanRange(), NearbyTargets);
+			Scanner->UpdateNearbyInteractables(NearbyTargets);
+		}
+	}
+}
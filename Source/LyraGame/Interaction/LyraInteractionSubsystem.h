@@ -0,0 +1,94 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "LyraInteractionSubsystem.generated.h"
+
+class IInteractableTarget;
+class UAbilityTask_GrantNearbyInteraction;
+
+/**
+ * ULyraInteractionSubsystem
+ *
+ * Keeps every registered interactable target in a uniform grid and resolves the neighbourhood of all
+ * nearby interaction scanners in a single pass, instead of each player running its own overlap query.
+ */
+UCLASS()
+class LYRAGAME_API ULyraInteractionSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	ULyraInteractionSubsystem();
+
+	//~USubsystem interface
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	// Returns true if scanners should use the grid (Lyra.Interaction.UseSpatialGrid)
+	static bool IsSpatialGridEnabled();
+
+	// Adds an actor or component implementing IInteractableTarget to the grid, targets that never
+	// register are only found by scanners while Lyra.Interaction.UseSpatialGrid is off
+	void RegisterInteractableTarget(TScriptInterface<IInteractableTarget> Target);
+
+	// Removes a target from the grid
+	void UnregisterInteractableTarget(TScriptInterface<IInteractableTarget> Target);
+
+	// Scanners are given the targets around their avatar every time their scan interval elapses
+	void RegisterScanner(UAbilityTask_GrantNearbyInteraction* Scanner);
+	void UnregisterScanner(UAbilityTask_GrantNearbyInteraction* Scanner);
+
+	// Appends every registered target whose bounds are within Range of Location and that responds to the interaction
+	// channel, the same targets the overlap query of a scanner would find
+	void QueryInteractableTargets(const FVector& Location, float Range, TArray<TScriptInterface<IInteractableTarget>>& OutTargets) const;
+
+private:
+	struct FInteractableEntry
+	{
+		TScriptInterface<IInteractableTarget> Target;
+		TWeakObjectPtr<UObject> WeakObject;
+		FObjectKey ObjectKey;
+		FVector Location = FVector::ZeroVector;
+		float Radius = 0.0f;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+		bool bHasBounds = false;
+	};
+
+	struct FScannerEntry
+	{
+		TWeakObjectPtr<UAbilityTask_GrantNearbyInteraction> WeakScanner;
+		double NextScanTime = 0.0;
+	};
+
+	FIntPoint GetCell(const FVector& Location) const;
+	void AddToCell(int32 EntryIndex);
+	void RemoveFromCell(int32 EntryIndex);
+	void RebuildGrid();
+
+	// Updates the location and radius of a target, returns false without touching its bounds if it has not moved
+	bool RefreshEntry(int32 EntryIndex);
+
+	// Returns true if the target has a primitive component an overlap query on the interaction channel would find
+	static bool RespondsToInteractionChannel(const FInteractableEntry& Entry);
+
+	void UpdateScanTimer();
+	void ScanAll();
+
+private:
+	TSparseArray<FInteractableEntry> Entries;
+	TMap<FObjectKey, int32> EntryIndexByObject;
+	TMap<FIntPoint, TArray<int32>> Cells;
+
+	// Largest registered target radius, queries are expanded by it so targets are only stored in one cell
+	float MaxEntryRadius = 0.0f;
+	float GridCellSize = 0.0f;
+
+	TArray<FScannerEntry> Scanners;
+	FTimerHandle ScanTimerHandle;
+	float ScanTimerRate = 0.0f;
+};
@@ -9,6 +9,7 @@
 #include "AbilitySystemComponent.h"
 #include "TimerManager.h"
 #include "GameFramework/Controller.h"
+#include "Interaction/LyraInteractionSubsystem.h"
 
 UAbilityTask_GrantNearbyInteraction::UAbilityTask_GrantNearbyInteraction(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -28,7 +29,17 @@ void UAbilityTask_GrantNearbyInteraction::Activate()
 	SetWaitingOnAvatar();
 
 	UWorld* World = GetWorld();
-	World->GetTimerManager().SetTimer(QueryTimerHandle, this, &ThisClass::QueryInteractables, InteractionScanRate, true);
+	ULyraInteractionSubsystem* InteractionSubsystem = World->GetSubsystem<ULyraInteractionSubsystem>();
+	if (InteractionSubsystem && ULyraInteractionSubsystem::IsSpatialGridEnabled())
+	{
+		// The subsystem scans for all avatars in one pass and calls UpdateNearbyInteractables
+		InteractionSubsystem->RegisterScanner(this);
+		bRegisteredWithInteractionSubsystem = true;
+	}
+	else
+	{
+		World->GetTimerManager().SetTimer(QueryTimerHandle, this, &ThisClass::QueryInteractables, InteractionScanRate, true);
+	}
 }
 
 void UAbilityTask_GrantNearbyInteraction::OnDestroy(bool AbilityEnded)
@@ -37,6 +48,15 @@ void UAbilityTask_GrantNearbyInteraction::OnDestroy(bool AbilityEnded)
 
 	UWorld* World = GetWorld();
 	World->GetTimerManager().ClearTimer(QueryTimerHandle);
+
+	if (bRegisteredWithInteractionSubsystem)
+	{
+		if (ULyraInteractionSubsystem* InteractionSubsystem = World->GetSubsystem<ULyraInteractionSubsystem>())
+		{
+			InteractionSubsystem->UnregisterScanner(this);
+		}
+		bRegisteredWithInteractionSubsystem = false;
+	}
 }
 
 void UAbilityTask_GrantNearbyInteraction::QueryInteractables()
@@ -51,36 +71,44 @@ void UAbilityTask_GrantNearbyInteraction::QueryInteractables()
 		TArray<FOverlapResult> OverlapResults;
 		World->OverlapMultiByChannel(OUT OverlapResults, ActorOwner->GetActorLocation(), FQuat::Identity, Lyra_TraceChannel_Interaction, FCollisionShape::MakeSphere(InteractionScanRange), Params);
 
-		if (OverlapResults.Num() > 0)
-		{
-			TArray<TScriptInterface<IInteractableTarget>> InteractableTargets;
-			UInteractionStatics::AppendInteractableTargetsFromOverlapResults(OverlapResults, OUT InteractableTargets);
-			
-			FInteractionQuery InteractionQuery;
-			InteractionQuery.RequestingAvatar = ActorOwner;
-			InteractionQuery.RequestingController = Cast<AController>(ActorOwner->GetOwner());
-
-			TArray<FInteractionOption> Options;
-			for (TScriptInterface<IInteractableTarget>& InteractiveTarget : InteractableTargets)
-			{
-				FInteractionOptionBuilder InteractionBuilder(InteractiveTarget, Options);
-				InteractiveTarget->GatherInteractionOptions(InteractionQuery, InteractionBuilder);
-			}
+		TArray<TScriptInterface<IInteractableTarget>> InteractableTargets;
+		UInteractionStatics::AppendInteractableTargetsFromOverlapResults(OverlapResults, OUT InteractableTargets);
+
+		UpdateNearbyInteractables(InteractableTargets);
+	}
+}
+
+void UAbilityTask_GrantNearbyInteraction::UpdateNearbyInteractables(const TArray<TScriptInterface<IInteractableTarget>>& InteractableTargets)
+{
+	AActor* ActorOwner = GetAvatarActor();
+	if (ActorOwner == nullptr)
+	{
+		return;
+	}
 
-			// Check if any of the options need to grant the ability to the user before they can be used.
-			for (FInteractionOption& Option : Options)
+	FInteractionQuery InteractionQuery;
+	InteractionQuery.RequestingAvatar = ActorOwner;
+	InteractionQuery.RequestingController = Cast<AController>(ActorOwner->GetOwner());
+
+	TArray<FInteractionOption> Options;
+	for (const TScriptInterface<IInteractableTarget>& InteractiveTarget : InteractableTargets)
+	{
+		FInteractionOptionBuilder InteractionBuilder(InteractiveTarget, Options);
+		InteractiveTarget->GatherInteractionOptions(InteractionQuery, InteractionBuilder);
+	}
+
+	// Check if any of the options need to grant the ability to the user before they can be used.
+	for (FInteractionOption& Option : Options)
+	{
+		if (Option.InteractionAbilityToGrant)
+		{
+			// Grant the ability to the GAS, otherwise it won't be able to do whatever the interaction is.
+			FObjectKey ObjectKey(Option.InteractionAbilityToGrant);
+			if (!InteractionAbilityCache.Find(ObjectKey))
 			{
-				if (Option.InteractionAbilityToGrant)
-				{
-					// Grant the ability to the GAS, otherwise it won't be able to do whatever the interaction is.
-					FObjectKey ObjectKey(Option.InteractionAbilityToGrant);
-					if (!InteractionAbilityCache.Find(ObjectKey))
-					{
-						FGameplayAbilitySpec Spec(Option.InteractionAbilityToGrant, 1, INDEX_NONE, this);
-						FGameplayAbilitySpecHandle Handle = AbilitySystemComponent->GiveAbility(Spec);
-						InteractionAbilityCache.Add(ObjectKey, Handle);
-					}
-				}
+				FGameplayAbilitySpec Spec(Option.InteractionAbilityToGrant, 1, INDEX_NONE, this);
+				FGameplayAbilitySpecHandle Handle = AbilitySystemComponent->GiveAbility(Spec);
+				InteractionAbilityCache.Add(ObjectKey, Handle);
 			}
 		}
 	}
@@ -8,6 +8,7 @@
 
 class AActor;
 class UPrimitiveComponent;
+class IInteractableTarget;
 
 UCLASS()
 class UAbilityTask_GrantNearbyInteraction : public UAbilityTask
@@ -20,16 +21,24 @@ class UAbilityTask_GrantNearbyInteraction : public UAbilityTask
 	UFUNCTION(BlueprintCallable, Category="Ability|Tasks", meta = (HidePin = "OwningAbility", DefaultToSelf = "OwningAbility", BlueprintInternalUseOnly = "TRUE"))
 	static UAbilityTask_GrantNearbyInteraction* GrantAbilitiesForNearbyInteractors(UGameplayAbility* OwningAbility, float InteractionScanRange, float InteractionScanRate);
 
+	float GetInteractionScanRange() const { return InteractionScanRange; }
+	float GetInteractionScanRate() const { return InteractionScanRate; }
+
+	/** Grants the abilities needed by the options of the interactable targets currently around the avatar */
+	void UpdateNearbyInteractables(const TArray<TScriptInterface<IInteractableTarget>>& InteractableTargets);
+
 private:
 
 	virtual void OnDestroy(bool AbilityEnded) override;
 
+	/** Fallback when the interaction subsystem's grid is disabled, runs an overlap query for this avatar only */
 	void QueryInteractables();
 
 	float InteractionScanRange = 100;
 	float InteractionScanRate = 0.100;
 
 	FTimerHandle QueryTimerHandle;
+	bool bRegisteredWithInteractionSubsystem = false;
 
 	TMap<FObjectKey, FGameplayAbilitySpecHandle> InteractionAbilityCache;
 };
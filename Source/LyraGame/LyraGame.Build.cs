@@ -78,6 +78,8 @@ public class LyraGame : ModuleRules
 
 		DynamicallyLoadedModuleNames.AddRange(
 			new string[] {
+				// The killcam recording overrides the replay streamer with this
+				"InMemoryNetworkReplayStreaming",
 			}
 		);
 
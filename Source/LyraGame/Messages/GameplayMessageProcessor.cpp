@@ -2,11 +2,16 @@
 
 #include "GameplayMessageProcessor.h"
 #include "GameFramework/GameStateBase.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/PlayerState.h"
 
 void UGameplayMessageProcessor::BeginPlay()
 {
 	Super::BeginPlay();
 
+	LogoutDelegateHandle = FGameModeEvents::GameModeLogoutEvent.AddUObject(this, &ThisClass::HandleGameModeLogout);
+
 	StartListening();
 }
 
@@ -16,6 +21,9 @@ void UGameplayMessageProcessor::EndPlay(const EEndPlayReason::Type EndPlayReason
 
 	StopListening();
 
+	FGameModeEvents::GameModeLogoutEvent.Remove(LogoutDelegateHandle);
+	LogoutDelegateHandle.Reset();
+
 	// Remove any listener handles
 	UGameplayMessageSubsystem& MessageSubsystem = UGameplayMessageSubsystem::Get(this);
 	for (FGameplayMessageListenerHandle& Handle : ListenerHandles)
@@ -39,6 +47,18 @@ void UGameplayMessageProcessor::AddListenerHandle(FGameplayMessageListenerHandle
 	ListenerHandles.Add(MoveTemp(Handle));
 }
 
+void UGameplayMessageProcessor::HandleGameModeLogout(AGameModeBase* GameMode, AController* Exiting)
+{
+	// The event is global, only care about players leaving our own world
+	if ((GameMode != nullptr) && (GameMode->GetWorld() == GetWorld()) && (Exiting != nullptr))
+	{
+		if (APlayerState* PlayerState = Exiting->PlayerState)
+		{
+			OnPlayerLoggedOut(PlayerState);
+		}
+	}
+}
+
 double UGameplayMessageProcessor::GetServerTime() const
 {
 	if (AGameStateBase* GameState = GetWorld()->GetGameState())
@@ -7,6 +7,10 @@
 #include "GameFramework/GameplayMessageSubsystem.h"
 #include "GameplayMessageProcessor.generated.h"
 
+class AController;
+class AGameModeBase;
+class APlayerState;
+
 /**
  * UGameplayMessageProcessor
  * 
@@ -34,6 +38,14 @@ protected:
 	void AddListenerHandle(FGameplayMessageListenerHandle&& Handle);
 	double GetServerTime() const;
 
+	// Called when a player leaves the match, processors should drop any state they are tracking for them
+	virtual void OnPlayerLoggedOut(APlayerState* PlayerState) { }
+
+private:
+	void HandleGameModeLogout(AGameModeBase* GameMode, AController* Exiting);
+
 private:
 	TArray<FGameplayMessageListenerHandle> ListenerHandles;
+
+	FDelegateHandle LogoutDelegateHandle;
 };
@@ -7,12 +7,138 @@
 #include "Engine/Engine.h"
 #include "Engine/NetConnection.h"
 #include "GameModes/LyraGameState.h"
+#include "AbilitySystem/LyraGameplayCueManager.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "LyraLogChannels.h"
+
+//////////////////////////////////////////////////////////////////////
+
+static FAutoConsoleCommandWithWorldAndArgs GDumpPerfStatsCSVCmd(
+	TEXT("Lyra.Perf.DumpCSV"),
+	TEXT("Writes the percentiles and recent per-frame samples of all performance stats to CSV files in Saved/Profiling. Optional argument: base filename"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(
+		[](const TArray<FString>& Params, UWorld* World)
+		{
+			UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+			if (const ULyraPerformanceStatSubsystem* StatSubsystem = GameInstance ? GameInstance->GetSubsystem<ULyraPerformanceStatSubsystem>() : nullptr)
+			{
+				const FString SummaryPath = StatSubsystem->DumpStatsToCSV((Params.Num() > 0) ? Params[0] : FString());
+				UE_LOG(LogLyra, Display, TEXT("Performance stats written to %s"), *SummaryPath);
+			}
+			else
+			{
+				UE_LOG(LogLyra, Error, TEXT("Lyra.Perf.DumpCSV failed, no ULyraPerformanceStatSubsystem found"));
+			}
+		}));
+
+//////////////////////////////////////////////////////////////////////
+// FLyraPerformanceStatHistory
+
+void FLyraPerformanceStatHistory::Reset()
+{
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+	{
+		BucketCounts[BucketIndex] = 0;
+	}
+	NumSamples = 0;
+	MinValue = 0.0;
+	MaxValue = 0.0;
+	SumValue = 0.0;
+}
+
+void FLyraPerformanceStatHistory::AddSample(double Value)
+{
+	RecentSamples[NumSamples % NumRecentSamples] = (float)Value;
+
+	MinValue = (NumSamples > 0) ? FMath::Min(MinValue, Value) : Value;
+	MaxValue = (NumSamples > 0) ? FMath::Max(MaxValue, Value) : Value;
+	SumValue += Value;
+	++NumSamples;
+
+	const double FixedPointValue = FMath::Clamp(Value * FixedPointScale, 0.0, (double)((1ull << MaxValueBits) - 1));
+	++BucketCounts[GetBucketIndex((uint64)FixedPointValue)];
+}
+
+double FLyraPerformanceStatHistory::GetPercentile(double Percentile) const
+{
+	if (NumSamples == 0)
+	{
+		return 0.0;
+	}
+
+	const int64 TargetCount = FMath::Max<int64>(1, (int64)FMath::CeilToDouble(FMath::Clamp(Percentile, 0.0, 100.0) * 0.01 * NumSamples));
+
+	int64 AccumulatedCount = 0;
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+	{
+		AccumulatedCount += BucketCounts[BucketIndex];
+		if (AccumulatedCount >= TargetCount)
+		{
+			return FMath::Clamp(GetBucketMidpoint(BucketIndex), MinValue, MaxValue);
+		}
+	}
+
+	return MaxValue;
+}
+
+double FLyraPerformanceStatHistory::GetRecentSample(int32 Index) const
+{
+	const int32 NumAvailable = GetNumRecentSamples();
+	if ((Index < 0) || (Index >= NumAvailable))
+	{
+		return 0.0;
+	}
+
+	const int64 OldestSample = NumSamples - NumAvailable;
+	return RecentSamples[(OldestSample + Index) % NumRecentSamples];
+}
+
+int32 FLyraPerformanceStatHistory::GetBucketIndex(uint64 FixedPointValue)
+{
+	// Small values map directly to their own bucket
+	if (FixedPointValue < SubBucketCount)
+	{
+		return (int32)FixedPointValue;
+	}
+
+	// Larger values keep SubBucketBits of precision, shifted down by their magnitude
+	const int32 Magnitude = (int32)FMath::FloorLog2_64(FixedPointValue) - (SubBucketBits - 1);
+	const int32 SubBucket = (int32)(FixedPointValue >> Magnitude) - SubBucketHalfCount;
+	return SubBucketCount + (Magnitude - 1) * SubBucketHalfCount + SubBucket;
+}
+
+double FLyraPerformanceStatHistory::GetBucketMidpoint(int32 BucketIndex)
+{
+	if (BucketIndex < SubBucketCount)
+	{
+		return BucketIndex / FixedPointScale;
+	}
+
+	const int32 Offset = BucketIndex - SubBucketCount;
+	const int32 Magnitude = (Offset / SubBucketHalfCount) + 1;
+	const uint64 SubBucket = (uint64)((Offset % SubBucketHalfCount) + SubBucketHalfCount);
+	const uint64 LowerBound = SubBucket << Magnitude;
+	const uint64 UpperBound = ((SubBucket + 1) << Magnitude) - 1;
+	return (0.5 * (LowerBound + UpperBound)) / FixedPointScale;
+}
 
 //////////////////////////////////////////////////////////////////////
 // FLyraPerformanceStatCache
 
 void FLyraPerformanceStatCache::StartCharting()
 {
+	ResetHistory();
+}
+
+void FLyraPerformanceStatCache::ResetHistory()
+{
+	for (ELyraDisplayablePerformanceStat Stat : TEnumRange<ELyraDisplayablePerformanceStat>())
+	{
+		StatHistories[(int32)Stat].Reset();
+	}
 }
 
 void FLyraPerformanceStatCache::ProcessFrame(const FFrameData& FrameData)
@@ -26,6 +152,14 @@ void FLyraPerformanceStatCache::ProcessFrame(const FFrameData& FrameData)
 	CachedPacketRateOutgoing = 0.0f;
 	CachedPacketSizeIncoming = 0.0f;
 	CachedPacketSizeOutgoing = 0.0f;
+	CachedGameplayCueHitRate = 0.0f;
+	CachedGameplayCueLateLoads = 0;
+
+	if (const ULyraGameplayCueManager* GCM = ULyraGameplayCueManager::Get())
+	{
+		CachedGameplayCueHitRate = GCM->GetCueInvocationHitRate();
+		CachedGameplayCueLateLoads = GCM->GetNumLateLoadedCues();
+	}
 
 	if (UWorld* World = MySubsystem->GetGameInstance()->GetWorld())
 	{
@@ -56,15 +190,77 @@ void FLyraPerformanceStatCache::ProcessFrame(const FFrameData& FrameData)
 			}
 		}
 	}
+
+	for (ELyraDisplayablePerformanceStat Stat : TEnumRange<ELyraDisplayablePerformanceStat>())
+	{
+		StatHistories[(int32)Stat].AddSample(GetCachedStat(Stat));
+	}
 }
 
 void FLyraPerformanceStatCache::StopCharting()
 {
 }
 
+FString FLyraPerformanceStatCache::WriteCSV(const FString& BaseFilename) const
+{
+	const FString OutputDir = FPaths::ProfilingDir() / TEXT("PerfStats");
+	IFileManager::Get().MakeDirectory(*OutputDir, true);
+
+	const UEnum* StatEnum = StaticEnum<ELyraDisplayablePerformanceStat>();
+
+	// One row per stat with its distribution since charting started
+	const FString SummaryFilename = OutputDir / (BaseFilename + TEXT("_Summary.csv"));
+	if (FArchive* SummaryFile = IFileManager::Get().CreateFileWriter(*SummaryFilename))
+	{
+		SummaryFile->Logf(TEXT("Stat,Samples,Min,Mean,P50,P95,P99,Max"));
+		for (ELyraDisplayablePerformanceStat Stat : TEnumRange<ELyraDisplayablePerformanceStat>())
+		{
+			const FLyraPerformanceStatHistory& History = GetStatHistory(Stat);
+			SummaryFile->Logf(TEXT("%s,%lld,%f,%f,%f,%f,%f,%f"),
+				*StatEnum->GetNameStringByValue((int64)Stat),
+				History.GetNumSamples(),
+				History.GetMin(),
+				History.GetMean(),
+				History.GetPercentile(50.0),
+				History.GetPercentile(95.0),
+				History.GetPercentile(99.0),
+				History.GetMax());
+		}
+		delete SummaryFile;
+	}
+
+	// One row per recent frame, one column per stat
+	const FString FramesFilename = OutputDir / (BaseFilename + TEXT("_Frames.csv"));
+	if (FArchive* FramesFile = IFileManager::Get().CreateFileWriter(*FramesFilename))
+	{
+		FString Line;
+		for (ELyraDisplayablePerformanceStat Stat : TEnumRange<ELyraDisplayablePerformanceStat>())
+		{
+			Line += Line.IsEmpty() ? TEXT("") : TEXT(",");
+			Line += StatEnum->GetNameStringByValue((int64)Stat);
+		}
+		FramesFile->Logf(TEXT("%s"), *Line);
+
+		const int32 NumFrames = GetStatHistory(ELyraDisplayablePerformanceStat::FrameTime).GetNumRecentSamples();
+		for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+		{
+			Line.Reset();
+			for (ELyraDisplayablePerformanceStat Stat : TEnumRange<ELyraDisplayablePerformanceStat>())
+			{
+				Line += Line.IsEmpty() ? TEXT("") : TEXT(",");
+				Line += FString::Printf(TEXT("%f"), GetStatHistory(Stat).GetRecentSample(FrameIndex));
+			}
+			FramesFile->Logf(TEXT("%s"), *Line);
+		}
+		delete FramesFile;
+	}
+
+	return IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*SummaryFilename);
+}
+
 double FLyraPerformanceStatCache::GetCachedStat(ELyraDisplayablePerformanceStat Stat) const
 {
-	static_assert((int32)ELyraDisplayablePerformanceStat::Count == 15, "Need to update this function to deal with new performance stats");
+	static_assert((int32)ELyraDisplayablePerformanceStat::Count == 17, "Need to update this function to deal with new performance stats");
 	switch (Stat)
 	{
 	case ELyraDisplayablePerformanceStat::ClientFPS:
@@ -97,6 +293,10 @@ double FLyraPerformanceStatCache::GetCachedStat(ELyraDisplayablePerformanceStat
 		return CachedPacketSizeIncoming;
 	case ELyraDisplayablePerformanceStat::PacketSize_Outgoing:
 		return CachedPacketSizeOutgoing;
+	case ELyraDisplayablePerformanceStat::GameplayCueHitRate:
+		return CachedGameplayCueHitRate;
+	case ELyraDisplayablePerformanceStat::GameplayCueLateLoads:
+		return CachedGameplayCueLateLoads;
 	}
 
 	return 0.0f;
@@ -121,3 +321,24 @@ double ULyraPerformanceStatSubsystem::GetCachedStat(ELyraDisplayablePerformanceS
 {
 	return Tracker->GetCachedStat(Stat);
 }
+
+double ULyraPerformanceStatSubsystem::GetStatPercentile(ELyraDisplayablePerformanceStat Stat, double Percentile) const
+{
+	return Tracker->GetStatHistory(Stat).GetPercentile(Percentile);
+}
+
+const FLyraPerformanceStatHistory& ULyraPerformanceStatSubsystem::GetStatHistory(ELyraDisplayablePerformanceStat Stat) const
+{
+	return Tracker->GetStatHistory(Stat);
+}
+
+void ULyraPerformanceStatSubsystem::ResetStatHistory()
+{
+	Tracker->ResetHistory();
+}
+
+FString ULyraPerformanceStatSubsystem::DumpStatsToCSV(const FString& BaseFilename) const
+{
+	const FString Filename = BaseFilename.IsEmpty() ? FString::Printf(TEXT("PerfStats_%s"), *FDateTime::Now().ToString()) : BaseFilename;
+	return Tracker->WriteCSV(Filename);
+}
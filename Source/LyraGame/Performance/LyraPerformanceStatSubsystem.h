@@ -3,6 +3,7 @@
 #pragma once
 
 #include "ChartCreation.h"
+#include "Containers/StaticArray.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "LyraPerformanceStatTypes.h"
 
@@ -12,6 +13,60 @@ class ULyraPerformanceStatSubsystem;
 
 //////////////////////////////////////////////////////////////////////
 
+// Fixed size history of a single stat, plus a histogram of every sample recorded since charting started.
+// Neither allocates after construction, so samples can be recorded every frame.
+struct FLyraPerformanceStatHistory
+{
+public:
+	// Number of recent samples kept for graphing and CSV export
+	static constexpr int32 NumRecentSamples = 1024;
+
+	FLyraPerformanceStatHistory()
+	{
+		Reset();
+	}
+
+	void Reset();
+	void AddSample(double Value);
+
+	// Returns the value below which the given percentage (0..100) of the samples fall, accurate to ~3%
+	double GetPercentile(double Percentile) const;
+
+	double GetMin() const { return (NumSamples > 0) ? MinValue : 0.0; }
+	double GetMax() const { return (NumSamples > 0) ? MaxValue : 0.0; }
+	double GetMean() const { return (NumSamples > 0) ? (SumValue / NumSamples) : 0.0; }
+	int64 GetNumSamples() const { return NumSamples; }
+
+	// Number of recent samples available (up to NumRecentSamples)
+	int32 GetNumRecentSamples() const { return (int32)FMath::Min<int64>(NumSamples, NumRecentSamples); }
+
+	// Returns a recent sample, 0 being the oldest one still available
+	double GetRecentSample(int32 Index) const;
+
+private:
+	// HDR-style histogram: values are stored as fixed point integers, bucketed by power of two
+	// with each power of two split into a fixed number of linear sub-buckets
+	static constexpr double FixedPointScale = 1000000.0;
+	static constexpr int32 SubBucketBits = 5;
+	static constexpr int32 SubBucketCount = 1 << SubBucketBits;
+	static constexpr int32 SubBucketHalfCount = SubBucketCount / 2;
+	static constexpr int32 MaxValueBits = 44;
+	static constexpr int32 NumBuckets = SubBucketCount + (MaxValueBits - SubBucketBits) * SubBucketHalfCount;
+
+	static int32 GetBucketIndex(uint64 FixedPointValue);
+	static double GetBucketMidpoint(int32 BucketIndex);
+
+	TStaticArray<uint32, NumBuckets> BucketCounts;
+	TStaticArray<float, NumRecentSamples> RecentSamples;
+
+	int64 NumSamples = 0;
+	double MinValue = 0.0;
+	double MaxValue = 0.0;
+	double SumValue = 0.0;
+};
+
+//////////////////////////////////////////////////////////////////////
+
 // Observer which caches the stats for the previous frame
 struct FLyraPerformanceStatCache : public IPerformanceDataConsumer
 {
@@ -29,7 +84,20 @@ public:
 
 	double GetCachedStat(ELyraDisplayablePerformanceStat Stat) const;
 
+	const FLyraPerformanceStatHistory& GetStatHistory(ELyraDisplayablePerformanceStat Stat) const
+	{
+		return StatHistories[(int32)Stat];
+	}
+
+	// Clears the recorded samples of every stat
+	void ResetHistory();
+
+	// Writes a summary (percentiles) and the recent per-frame samples of every stat as CSV files, returning the summary path
+	FString WriteCSV(const FString& BaseFilename) const;
+
 protected:
+	TStaticArray<FLyraPerformanceStatHistory, (int32)ELyraDisplayablePerformanceStat::Count> StatHistories;
+
 	IPerformanceDataConsumer::FFrameData CachedData;
 	ULyraPerformanceStatSubsystem* MySubsystem;
 
@@ -41,6 +109,8 @@ protected:
 	float CachedPacketRateOutgoing = 0.0f;
 	float CachedPacketSizeIncoming = 0.0f;
 	float CachedPacketSizeOutgoing = 0.0f;
+	float CachedGameplayCueHitRate = 0.0f;
+	int32 CachedGameplayCueLateLoads = 0;
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -55,6 +125,19 @@ public:
 	UFUNCTION(BlueprintCallable)
 	double GetCachedStat(ELyraDisplayablePerformanceStat Stat) const;
 
+	// Returns the value below which the given percentage (0..100) of the stat samples fall since charting started
+	UFUNCTION(BlueprintCallable)
+	double GetStatPercentile(ELyraDisplayablePerformanceStat Stat, double Percentile) const;
+
+	const FLyraPerformanceStatHistory& GetStatHistory(ELyraDisplayablePerformanceStat Stat) const;
+
+	// Clears the recorded samples, e.g. to only measure a specific part of a session
+	void ResetStatHistory();
+
+	// Writes the stat summary and recent samples to Saved/Profiling, returning the path of the summary file
+	// (uses a timestamped name if BaseFilename is empty)
+	FString DumpStatsToCSV(const FString& BaseFilename = FString()) const;
+
 	//~USubsystem interface
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
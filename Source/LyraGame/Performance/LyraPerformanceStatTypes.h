@@ -77,6 +77,12 @@ enum class ELyraDisplayablePerformanceStat : uint8
 	// The avg. size (in bytes) of packets sent
 	PacketSize_Outgoing,
 
+	// The percentage of gameplay cues that were already loaded when invoked (%)
+	GameplayCueHitRate,
+
+	// The number of gameplay cues that had to be loaded on demand when invoked
+	GameplayCueLateLoads,
+
 	// New stats should go above here
 	Count UMETA(Hidden)
 };
@@ -0,0 +1,198 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Performance/LyraServerTelemetry.h"
+#include "Engine/World.h"
+#include "Engine/NetDriver.h"
+#include "Engine/NetConnection.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "LyraLogChannels.h"
+
+namespace LyraServerTelemetry
+{
+	static float SampleInterval = 1.0f;
+	static FAutoConsoleVariableRef CVarSampleInterval(
+		TEXT("Lyra.ServerTelemetry.SampleInterval"),
+		SampleInterval,
+		TEXT("Length in seconds of each server telemetry sample window"),
+		ECVF_Default);
+
+	static float MinFPSChange = 2.0f;
+	static FAutoConsoleVariableRef CVarMinFPSChange(
+		TEXT("Lyra.ServerTelemetry.MinFPSChange"),
+		MinFPSChange,
+		TEXT("Change in average server FPS needed before the telemetry is replicated to every client again"),
+		ECVF_Default);
+
+	static float MinFrameTimeChangeMs = 1.0f;
+	static FAutoConsoleVariableRef CVarMinFrameTimeChangeMs(
+		TEXT("Lyra.ServerTelemetry.MinFrameTimeChangeMs"),
+		MinFrameTimeChangeMs,
+		TEXT("Change in any server frame time percentile (in ms) needed before the telemetry is replicated to every client again"),
+		ECVF_Default);
+
+	static float MinNetSaturationChange = 0.05f;
+	static FAutoConsoleVariableRef CVarMinNetSaturationChange(
+		TEXT("Lyra.ServerTelemetry.MinNetSaturationChange"),
+		MinNetSaturationChange,
+		TEXT("Change in the fraction of saturated connections needed before the telemetry is replicated to every client again"),
+		ECVF_Default);
+
+	static int32 MaxCSVRows = 3600;
+	static FAutoConsoleVariableRef CVarMaxCSVRows(
+		TEXT("Lyra.ServerTelemetry.MaxCSVRows"),
+		MaxCSVRows,
+		TEXT("Number of samples written to the dedicated server telemetry CSV before it is rolled over to ServerTelemetry_Previous.csv (0 disables the CSV)"),
+		ECVF_Default);
+}
+
+//////////////////////////////////////////////////////////////////////
+// FLyraServerTelemetry
+
+FLyraServerTelemetry FLyraServerTelemetry::Make(double InAverageFPS, double InFrameTimeP50Ms, double InFrameTimeP95Ms, double InFrameTimeP99Ms, int32 InNumPlayers, double InNetSaturation)
+{
+	auto QuantizeFrameTime = [](double FrameTimeMs)
+	{
+		return (uint16)FMath::Clamp<int64>(FMath::RoundToInt64(FrameTimeMs / FrameTimeScaleMs), 0, MAX_uint16);
+	};
+
+	FLyraServerTelemetry Result;
+	Result.AverageFPS = (uint16)FMath::Clamp<int64>(FMath::RoundToInt64(InAverageFPS), 0, MAX_uint16);
+	Result.FrameTimeP50 = QuantizeFrameTime(InFrameTimeP50Ms);
+	Result.FrameTimeP95 = QuantizeFrameTime(InFrameTimeP95Ms);
+	Result.FrameTimeP99 = QuantizeFrameTime(InFrameTimeP99Ms);
+	Result.NumPlayers = (uint16)FMath::Clamp<int32>(InNumPlayers, 0, MAX_uint16);
+	Result.NetSaturation = (uint8)FMath::Clamp<int64>(FMath::RoundToInt64(InNetSaturation * 255.0), 0, MAX_uint8);
+	return Result;
+}
+
+bool FLyraServerTelemetry::HasMeaningfulChange(const FLyraServerTelemetry& Other) const
+{
+	return (NumPlayers != Other.NumPlayers) ||
+		(FMath::Abs(GetAverageFPS() - Other.GetAverageFPS()) >= LyraServerTelemetry::MinFPSChange) ||
+		(FMath::Abs(GetFrameTimeP50Ms() - Other.GetFrameTimeP50Ms()) >= LyraServerTelemetry::MinFrameTimeChangeMs) ||
+		(FMath::Abs(GetFrameTimeP95Ms() - Other.GetFrameTimeP95Ms()) >= LyraServerTelemetry::MinFrameTimeChangeMs) ||
+		(FMath::Abs(GetFrameTimeP99Ms() - Other.GetFrameTimeP99Ms()) >= LyraServerTelemetry::MinFrameTimeChangeMs) ||
+		(FMath::Abs(GetNetSaturation() - Other.GetNetSaturation()) >= LyraServerTelemetry::MinNetSaturationChange);
+}
+
+//////////////////////////////////////////////////////////////////////
+// FLyraServerTelemetryCollector
+
+FLyraServerTelemetryCollector::FLyraServerTelemetryCollector(bool bInWriteCSV)
+	: bWriteCSV(bInWriteCSV)
+{
+}
+
+FLyraServerTelemetryCollector::~FLyraServerTelemetryCollector()
+{
+	if (CSVFile)
+	{
+		CSVFile->Close();
+	}
+}
+
+bool FLyraServerTelemetryCollector::Tick(float DeltaTime, const UWorld* World, int32 NumPlayers, FLyraServerTelemetry& OutTelemetry)
+{
+	FrameTimeHistory.AddSample(DeltaTime * 1000.0);
+	NetSaturationSum += GetNetSaturation(World);
+	WindowDuration += DeltaTime;
+
+	if (WindowDuration < LyraServerTelemetry::SampleInterval)
+	{
+		return false;
+	}
+
+	const int64 NumFrames = FrameTimeHistory.GetNumSamples();
+	OutTelemetry = FLyraServerTelemetry::Make(
+		NumFrames / WindowDuration,
+		FrameTimeHistory.GetPercentile(50.0),
+		FrameTimeHistory.GetPercentile(95.0),
+		FrameTimeHistory.GetPercentile(99.0),
+		NumPlayers,
+		NetSaturationSum / NumFrames);
+
+	FrameTimeHistory.Reset();
+	NetSaturationSum = 0.0;
+	WindowDuration = 0.0;
+
+	if (bWriteCSV && (LyraServerTelemetry::MaxCSVRows > 0))
+	{
+		WriteCSVRow(OutTelemetry);
+	}
+
+	return true;
+}
+
+double FLyraServerTelemetryCollector::GetNetSaturation(const UWorld* World)
+{
+	const UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr;
+	if ((NetDriver == nullptr) || (NetDriver->ClientConnections.Num() == 0))
+	{
+		return 0.0;
+	}
+
+	int32 NumSaturated = 0;
+	for (UNetConnection* Connection : NetDriver->ClientConnections)
+	{
+		if (Connection && (Connection->IsNetReady(false) == 0))
+		{
+			++NumSaturated;
+		}
+	}
+
+	return NumSaturated / (double)NetDriver->ClientConnections.Num();
+}
+
+void FLyraServerTelemetryCollector::OpenCSVFile()
+{
+	const FString OutputDir = FPaths::ProfilingDir() / TEXT("ServerTelemetry");
+	const FString CurrentFilename = OutputDir / TEXT("ServerTelemetry.csv");
+
+	IFileManager& FileManager = IFileManager::Get();
+	FileManager.MakeDirectory(*OutputDir, true);
+
+	// Keep the previous file around so there's always at least MaxCSVRows samples on disk
+	if (FileManager.FileExists(*CurrentFilename))
+	{
+		FileManager.Move(*(OutputDir / TEXT("ServerTelemetry_Previous.csv")), *CurrentFilename, /*Replace=*/ true);
+	}
+
+	CSVFile.Reset(FileManager.CreateFileWriter(*CurrentFilename));
+	NumCSVRows = 0;
+
+	if (CSVFile)
+	{
+		CSVFile->Logf(TEXT("Time,AverageFPS,FrameTimeP50Ms,FrameTimeP95Ms,FrameTimeP99Ms,NumPlayers,NetSaturation"));
+	}
+	else
+	{
+		UE_LOG(LogLyra, Warning, TEXT("Failed to open server telemetry CSV %s, disabling it"), *CurrentFilename);
+		bWriteCSV = false;
+	}
+}
+
+void FLyraServerTelemetryCollector::WriteCSVRow(const FLyraServerTelemetry& Telemetry)
+{
+	if (!CSVFile || (NumCSVRows >= LyraServerTelemetry::MaxCSVRows))
+	{
+		CSVFile.Reset();
+		OpenCSVFile();
+	}
+
+	if (CSVFile)
+	{
+		CSVFile->Logf(TEXT("%s,%.0f,%.1f,%.1f,%.1f,%d,%.3f"),
+			*FDateTime::UtcNow().ToIso8601(),
+			Telemetry.GetAverageFPS(),
+			Telemetry.GetFrameTimeP50Ms(),
+			Telemetry.GetFrameTimeP95Ms(),
+			Telemetry.GetFrameTimeP99Ms(),
+			Telemetry.GetNumPlayers(),
+			Telemetry.GetNetSaturation());
+		CSVFile->Flush();
+		++NumCSVRows;
+	}
+}
@@ -0,0 +1,87 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Performance/LyraPerformanceStatSubsystem.h"
+#include "Templates/UniquePtr.h"
+
+#include "LyraServerTelemetry.generated.h"
+
+class UWorld;
+
+//////////////////////////////////////////////////////////////////////
+
+// Quantized summary of server performance over one sample window, small enough to replicate
+USTRUCT()
+struct FLyraServerTelemetry
+{
+	GENERATED_BODY()
+
+public:
+	float GetAverageFPS() const { return AverageFPS; }
+	float GetFrameTimeP50Ms() const { return FrameTimeP50 * FrameTimeScaleMs; }
+	float GetFrameTimeP95Ms() const { return FrameTimeP95 * FrameTimeScaleMs; }
+	float GetFrameTimeP99Ms() const { return FrameTimeP99 * FrameTimeScaleMs; }
+	int32 GetNumPlayers() const { return NumPlayers; }
+
+	// Average fraction (0..1) of client connections that were saturated during the window
+	float GetNetSaturation() const { return NetSaturation / 255.0f; }
+
+	// Quantizes the given values into a telemetry sample
+	static FLyraServerTelemetry Make(double InAverageFPS, double InFrameTimeP50Ms, double InFrameTimeP95Ms, double InFrameTimeP99Ms, int32 InNumPlayers, double InNetSaturation);
+
+	// Returns true if this sample differs enough from Other to be worth replicating to everyone
+	bool HasMeaningfulChange(const FLyraServerTelemetry& Other) const;
+
+private:
+	// Frame times are stored in tenths of a millisecond
+	static constexpr float FrameTimeScaleMs = 0.1f;
+
+	UPROPERTY()
+	uint16 AverageFPS = 0;
+
+	UPROPERTY()
+	uint16 FrameTimeP50 = 0;
+
+	UPROPERTY()
+	uint16 FrameTimeP95 = 0;
+
+	UPROPERTY()
+	uint16 FrameTimeP99 = 0;
+
+	UPROPERTY()
+	uint16 NumPlayers = 0;
+
+	UPROPERTY()
+	uint8 NetSaturation = 0;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+// Gathers server frame times and net saturation into telemetry samples at a fixed interval,
+// optionally appending every sample to a rolling CSV file in Saved/Profiling/ServerTelemetry
+class FLyraServerTelemetryCollector
+{
+public:
+	FLyraServerTelemetryCollector(bool bInWriteCSV);
+	~FLyraServerTelemetryCollector();
+
+	// Records a server frame, returns true and fills OutTelemetry when a sample window was completed
+	bool Tick(float DeltaTime, const UWorld* World, int32 NumPlayers, FLyraServerTelemetry& OutTelemetry);
+
+private:
+	static double GetNetSaturation(const UWorld* World);
+
+	void WriteCSVRow(const FLyraServerTelemetry& Telemetry);
+	void OpenCSVFile();
+
+	FLyraPerformanceStatHistory FrameTimeHistory;
+
+	double WindowDuration = 0.0;
+	double NetSaturationSum = 0.0;
+
+	TUniquePtr<FArchive> CSVFile;
+	int32 NumCSVRows = 0;
+	bool bWriteCSV = false;
+};
@@ -17,6 +17,19 @@
 #include "LyraLocalPlayer.h"
 #include "Settings/LyraSettingsShared.h"
 #include "Development/LyraDeveloperSettings.h"
+#include "GameModes/LyraGameState.h"
+
+static FAutoConsoleCommandWithWorldAndArgs GSubscribeServerTelemetryCmd(
+	TEXT("Lyra.ServerTelemetry.Subscribe"),
+	TEXT("Usage: Lyra.ServerTelemetry.Subscribe [0|1]. Receive every server telemetry sample instead of only meaningful changes (spectators and players allowed to cheat only)"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(
+		[](const TArray<FString>& Params, UWorld* World)
+		{
+			if (ALyraPlayerController* LyraPC = Cast<ALyraPlayerController>(World ? World->GetFirstPlayerController() : nullptr))
+			{
+				LyraPC->ServerSetServerTelemetrySubscribed((Params.Num() == 0) || Params[0].ToBool());
+			}
+		}));
 
 ALyraPlayerController::ALyraPlayerController(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -207,6 +220,37 @@ bool ALyraPlayerController::ServerCheatAll_Validate(const FString& Msg)
 	return true;
 }
 
+void ALyraPlayerController::ServerSetServerTelemetrySubscribed_Implementation(bool bSubscribed)
+{
+	ALyraGameState* LyraGameState = GetWorld()->GetGameState<ALyraGameState>();
+	if (LyraGameState == nullptr)
+	{
+		return;
+	}
+
+	if (bSubscribed)
+	{
+		const AGameModeBase* GameMode = GetWorld()->GetAuthGameMode();
+		const bool bIsSpectator = PlayerState && PlayerState->IsOnlyASpectator();
+		const bool bCanCheat = GameMode && GameMode->AllowCheats(this);
+		if (!bIsSpectator && !bCanCheat)
+		{
+			UE_LOG(LogLyra, Warning, TEXT("%s is not allowed to subscribe to server telemetry"), *GetNameSafe(this));
+			return;
+		}
+	}
+
+	LyraGameState->SetServerTelemetrySubscription(this, bSubscribed);
+}
+
+void ALyraPlayerController::ClientReceiveServerTelemetry_Implementation(const FLyraServerTelemetry& Telemetry)
+{
+	if (ALyraGameState* LyraGameState = GetWorld()->GetGameState<ALyraGameState>())
+	{
+		LyraGameState->ReceiveServerTelemetry(Telemetry);
+	}
+}
+
 void ALyraPlayerController::PreProcessInput(const float DeltaTime, const bool bGamePaused)
 {
 	Super::PreProcessInput(DeltaTime, bGamePaused);
@@ -7,6 +7,7 @@
 #include "CommonPlayerController.h"
 #include "Camera/LyraCameraAssistInterface.h"
 #include "Teams/LyraTeamAgentInterface.h"
+#include "Performance/LyraServerTelemetry.h"
 #include "LyraPlayerController.generated.h"
 
 class ULyraSettingsShared;
@@ -46,6 +47,14 @@ public:
 	UFUNCTION(Reliable, Server, WithValidation)
 	void ServerCheatAll(const FString& Msg);
 
+	// Ask the server to send every server telemetry sample to this player (only honored for spectators and players allowed to cheat)
+	UFUNCTION(Reliable, Server)
+	void ServerSetServerTelemetrySubscribed(bool bSubscribed);
+
+	// Receives a server telemetry sample while subscribed
+	UFUNCTION(Unreliable, Client)
+	void ClientReceiveServerTelemetry(const FLyraServerTelemetry& Telemetry);
+
 	//~AActor interface
 	virtual void PreInitializeComponents() override;
 	virtual void BeginPlay() override;
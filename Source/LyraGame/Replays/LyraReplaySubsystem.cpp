@@ -4,6 +4,45 @@
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
 #include "Engine/DemoNetDriver.h"
+#include "ReplaySubsystem.h"
+#include "TimerManager.h"
+#include "Engine/Engine.h"
+#include "Engine/LevelCollection.h"
+#include "LyraLogChannels.h"
+
+namespace LyraKillcam
+{
+	static const TCHAR* ReplayName = TEXT("LyraKillcam");
+	static const TCHAR* StreamerOverrideOption = TEXT("ReplayStreamerOverride=InMemoryNetworkReplayStreaming");
+	static const TCHAR* DuplicatedLevelsOption = TEXT("LevelPrefixOverride=1");
+	static const FName PlaybackDriverName(TEXT("LyraKillcamDemoNetDriver"));
+
+	static float BufferSeconds = 15.0f;
+	static FAutoConsoleVariableRef CVarBufferSeconds(
+		TEXT("Lyra.Killcam.BufferSeconds"),
+		BufferSeconds,
+		TEXT("How many seconds of gameplay the in-memory killcam recording keeps, older data is discarded to bound memory."),
+		ECVF_Default);
+
+	static float CheckpointInterval = 3.0f;
+	static FAutoConsoleVariableRef CVarCheckpointInterval(
+		TEXT("Lyra.Killcam.CheckpointInterval"),
+		CheckpointInterval,
+		TEXT("Seconds between checkpoints of the killcam recording. Closer checkpoints make seeks cheaper but cost memory and record time."),
+		ECVF_Default);
+
+	static bool bDuplicateLevels = false;
+	static FAutoConsoleVariableRef CVarDuplicateLevels(
+		TEXT("Lyra.Killcam.DuplicateLevels"),
+		bDuplicateLevels,
+		TEXT("Load maps with a duplicated copy of their levels so the killcam can play back next to the live game. Costs the memory of a second copy of the map, applies to the next map load."),
+		ECVF_Default);
+}
+
+bool ULyraReplaySubsystem::ShouldDuplicateLevelsForKillcam()
+{
+	return LyraKillcam::bDuplicateLevels && !IsRunningDedicatedServer();
+}
 
 ULyraReplaySubsystem::ULyraReplaySubsystem()
 {
@@ -25,7 +64,7 @@ void ULyraReplaySubsystem::PlayReplay(ULyraReplayListEntry* Replay)
 
 void ULyraReplaySubsystem::SeekInActiveReplay(float TimeInSeconds)
 {
-	if (UDemoNetDriver* DemoDriver = GetDemoDriver())
+	if (UDemoNetDriver* DemoDriver = GetActiveReplayDriver())
 	{
 		DemoDriver->GotoTimeInSeconds(TimeInSeconds);
 	}
@@ -33,7 +72,7 @@ void ULyraReplaySubsystem::SeekInActiveReplay(float TimeInSeconds)
 
 float ULyraReplaySubsystem::GetReplayLengthInSeconds() const
 {
-	if (UDemoNetDriver* DemoDriver = GetDemoDriver())
+	if (UDemoNetDriver* DemoDriver = GetActiveReplayDriver())
 	{
 		return DemoDriver->GetDemoTotalTime();
 	}
@@ -42,13 +81,196 @@ float ULyraReplaySubsystem::GetReplayLengthInSeconds() const
 
 float ULyraReplaySubsystem::GetReplayCurrentTime() const
 {
-	if (UDemoNetDriver* DemoDriver = GetDemoDriver())
+	if (UDemoNetDriver* DemoDriver = GetActiveReplayDriver())
 	{
 		return DemoDriver->GetDemoCurrentTime();
 	}
 	return 0.0f;
 }
 
+void ULyraReplaySubsystem::StartKillcamRecording()
+{
+	if (IsRecordingKillcam())
+	{
+		return;
+	}
+
+	UGameInstance* GameInstance = GetGameInstance();
+	GameInstance->StartRecordingReplay(LyraKillcam::ReplayName, LyraKillcam::ReplayName, { LyraKillcam::StreamerOverrideOption });
+
+	UDemoNetDriver* DemoDriver = GetDemoDriver();
+	if ((DemoDriver == nullptr) || !DemoDriver->IsRecording())
+	{
+		UE_LOG(LogLyra, Warning, TEXT("Failed to start the killcam recording"));
+		return;
+	}
+
+	// The in-memory streamer drops the stream chunks and checkpoints that fall out of this window
+	if (const TSharedPtr<INetworkReplayStreamer> ReplayStreamer = DemoDriver->GetReplayStreamer())
+	{
+		ReplayStreamer->SetTimeBufferHintSeconds(LyraKillcam::BufferSeconds);
+	}
+
+	bRecordingKillcam = true;
+
+	GameInstance->GetTimerManager().SetTimer(KillcamCheckpointTimerHandle, this, &ThisClass::RequestKillcamCheckpoint, FMath::Max(LyraKillcam::CheckpointInterval, 0.1f), true);
+
+	UE_LOG(LogLyra, Log, TEXT("Started killcam recording (%.1fs buffer, checkpoint every %.1fs)"), LyraKillcam::BufferSeconds, LyraKillcam::CheckpointInterval);
+}
+
+void ULyraReplaySubsystem::StopKillcamRecording()
+{
+	if (!bRecordingKillcam)
+	{
+		return;
+	}
+
+	UGameInstance* GameInstance = GetGameInstance();
+	GameInstance->GetTimerManager().ClearTimer(KillcamCheckpointTimerHandle);
+
+	if (IsRecordingKillcam())
+	{
+		GameInstance->StopRecordingReplay();
+	}
+
+	bRecordingKillcam = false;
+}
+
+bool ULyraReplaySubsystem::IsRecordingKillcam() const
+{
+	if (bRecordingKillcam)
+	{
+		if (UDemoNetDriver* DemoDriver = GetDemoDriver())
+		{
+			return DemoDriver->IsRecording();
+		}
+	}
+	return false;
+}
+
+void ULyraReplaySubsystem::PlayKillcamReplay()
+{
+	StopKillcamPlayback();
+
+	// Playing the killcam with UGameInstance::PlayReplay would load the demo over the live world
+	UWorld* World = GetGameInstance()->GetWorld();
+	const int32 KillcamCollectionIndex = World ? World->FindCollectionIndexByType(ELevelCollectionType::DynamicDuplicatedLevels) : INDEX_NONE;
+	if (KillcamCollectionIndex == INDEX_NONE)
+	{
+		UE_LOG(LogLyra, Warning, TEXT("Cannot play the killcam, the map was not loaded with duplicated levels (Lyra.Killcam.DuplicateLevels)"));
+		return;
+	}
+
+	if (!GEngine->CreateNamedNetDriver(World, LyraKillcam::PlaybackDriverName, NAME_DemoNetDriver))
+	{
+		UE_LOG(LogLyra, Warning, TEXT("Failed to create the killcam playback driver"));
+		return;
+	}
+
+	KillcamPlaybackDriver = Cast<UDemoNetDriver>(GEngine->FindNamedNetDriver(World, LyraKillcam::PlaybackDriverName));
+	check(KillcamPlaybackDriver);
+
+	FLevelCollection& KillcamCollection = World->GetLevelCollections()[KillcamCollectionIndex];
+	KillcamCollection.SetDemoNetDriver(KillcamPlaybackDriver);
+
+	FURL DemoURL;
+	DemoURL.Map = LyraKillcam::ReplayName;
+	DemoURL.AddOption(LyraKillcam::StreamerOverrideOption);
+	DemoURL.AddOption(LyraKillcam::DuplicatedLevelsOption);
+
+	FString Error;
+	{
+		// Actors spawned by the playback go into the duplicated levels
+		FScopedLevelCollectionContextSwitch ContextSwitch(KillcamCollectionIndex, World);
+
+		KillcamPlaybackDriver->SetWorld(World);
+		if (!KillcamPlaybackDriver->InitConnect(World, DemoURL, Error))
+		{
+			UE_LOG(LogLyra, Warning, TEXT("Failed to start killcam playback: %s"), *Error);
+			StopKillcamPlayback();
+			return;
+		}
+	}
+
+	KillcamCollection.SetIsVisible(true);
+	if (FLevelCollection* LiveCollection = World->FindCollectionByType(ELevelCollectionType::DynamicSourceLevels))
+	{
+		LiveCollection->SetIsVisible(false);
+	}
+}
+
+void ULyraReplaySubsystem::StopKillcamPlayback()
+{
+	if (KillcamPlaybackDriver == nullptr)
+	{
+		return;
+	}
+
+	if (UWorld* World = GetGameInstance()->GetWorld())
+	{
+		if (FLevelCollection* KillcamCollection = World->FindCollectionByType(ELevelCollectionType::DynamicDuplicatedLevels))
+		{
+			KillcamCollection->SetDemoNetDriver(nullptr);
+			KillcamCollection->SetIsVisible(false);
+		}
+
+		if (FLevelCollection* LiveCollection = World->FindCollectionByType(ELevelCollectionType::DynamicSourceLevels))
+		{
+			LiveCollection->SetIsVisible(true);
+		}
+
+		GEngine->DestroyNamedNetDriver(World, LyraKillcam::PlaybackDriverName);
+	}
+
+	KillcamPlaybackDriver = nullptr;
+	bSeekInProgress = false;
+}
+
+bool ULyraReplaySubsystem::IsPlayingKillcam() const
+{
+	return IsValid(KillcamPlaybackDriver) && KillcamPlaybackDriver->IsPlaying();
+}
+
+void ULyraReplaySubsystem::RequestKillcamCheckpoint()
+{
+	UDemoNetDriver* DemoDriver = GetDemoDriver();
+	if ((DemoDriver == nullptr) || !DemoDriver->IsRecording())
+	{
+		// The recording went away with the world
+		StopKillcamRecording();
+		return;
+	}
+
+	if (UReplaySubsystem* ReplaySubsystem = GetGameInstance()->GetSubsystem<UReplaySubsystem>())
+	{
+		ReplaySubsystem->RequestCheckpoint();
+	}
+}
+
+void ULyraReplaySubsystem::FastSeekInActiveReplay(float TimeInSeconds)
+{
+	if (UDemoNetDriver* DemoDriver = GetActiveReplayDriver())
+	{
+		// GotoTimeInSeconds restores the nearest earlier checkpoint and simulates forward from there
+		SeekStartTime = FPlatformTime::Seconds();
+		bSeekInProgress = true;
+		DemoDriver->GotoTimeInSeconds(TimeInSeconds, FOnGotoTimeDelegate::CreateUObject(this, &ThisClass::HandleSeekCompleted));
+	}
+}
+
+void ULyraReplaySubsystem::HandleSeekCompleted(bool bWasSuccessful)
+{
+	LastSeekDuration = FPlatformTime::Seconds() - SeekStartTime;
+	bSeekInProgress = false;
+	bLastSeekSucceeded = bWasSuccessful;
+	UE_LOG(LogLyra, Verbose, TEXT("Replay seek %s after %.1f ms"), bWasSuccessful ? TEXT("completed") : TEXT("failed"), LastSeekDuration * 1000.0f);
+}
+
+UDemoNetDriver* ULyraReplaySubsystem::GetActiveReplayDriver() const
+{
+	return IsPlayingKillcam() ? KillcamPlaybackDriver.Get() : GetDemoDriver();
+}
+
 UDemoNetDriver* ULyraReplaySubsystem::GetDemoDriver() const
 {
 	if (UWorld* World = GetGameInstance()->GetWorld())
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "NetworkReplayStreaming.h"
+#include "Engine/EngineTypes.h"
 
 #include "LyraReplaySubsystem.generated.h"
 
@@ -73,6 +74,71 @@ public:
 	UFUNCTION(BlueprintCallable, Category=Replays, BlueprintPure=false)
 	float GetReplayCurrentTime() const;
 
+	/**
+	 * Starts recording the current game into an in-memory rolling buffer that only keeps the last
+	 * Lyra.Killcam.BufferSeconds seconds, with a checkpoint every Lyra.Killcam.CheckpointInterval seconds
+	 */
+	UFUNCTION(BlueprintCallable, Category=Replays)
+	void StartKillcamRecording();
+
+	UFUNCTION(BlueprintCallable, Category=Replays)
+	void StopKillcamRecording();
+
+	UFUNCTION(BlueprintCallable, Category=Replays, BlueprintPure=false)
+	bool IsRecordingKillcam() const;
+
+	/**
+	 * Plays back the in-memory killcam recording into the duplicated copy of the current map, next to the live game.
+	 * The live levels are hidden until StopKillcamPlayback.  Requires Lyra.Killcam.DuplicateLevels when the map was loaded.
+	 */
+	UFUNCTION(BlueprintCallable, Category=Replays)
+	void PlayKillcamReplay();
+
+	/** Stops killcam playback and shows the live levels again */
+	UFUNCTION(BlueprintCallable, Category=Replays)
+	void StopKillcamPlayback();
+
+	UFUNCTION(BlueprintCallable, Category=Replays, BlueprintPure=false)
+	bool IsPlayingKillcam() const;
+
+	/** Seeks the active replay (the killcam while it is playing) and records how long the seek takes, see GetLastSeekDuration */
+	UFUNCTION(BlueprintCallable, Category=Replays)
+	void FastSeekInActiveReplay(float TimeInSeconds);
+
+	/** Returns how long the last seek took to complete, in seconds */
+	UFUNCTION(BlueprintCallable, Category=Replays, BlueprintPure=false)
+	float GetLastSeekDuration() const { return LastSeekDuration; }
+
+	/** Returns true while a seek started by FastSeekInActiveReplay has not completed yet */
+	UFUNCTION(BlueprintCallable, Category=Replays, BlueprintPure=false)
+	bool IsSeekInProgress() const { return bSeekInProgress; }
+
+	/** Returns true if the last seek completed successfully */
+	UFUNCTION(BlueprintCallable, Category=Replays, BlueprintPure=false)
+	bool WasLastSeekSuccessful() const { return bLastSeekSucceeded; }
+
+	/** Returns true if maps should be loaded with a duplicated level collection for killcam playback */
+	static bool ShouldDuplicateLevelsForKillcam();
+
 private:
 	UDemoNetDriver* GetDemoDriver() const;
+
+	/** Returns the killcam playback driver if a killcam is playing, otherwise the world's demo driver */
+	UDemoNetDriver* GetActiveReplayDriver() const;
+
+	void RequestKillcamCheckpoint();
+	void HandleSeekCompleted(bool bWasSuccessful);
+
+private:
+	FTimerHandle KillcamCheckpointTimerHandle;
+	bool bRecordingKillcam = false;
+
+	/** The demo driver playing the killcam into the duplicated level collection */
+	UPROPERTY(Transient)
+	TObjectPtr<UDemoNetDriver> KillcamPlaybackDriver;
+
+	double SeekStartTime = 0.0;
+	float LastSeekDuration = 0.0f;
+	bool bSeekInProgress = false;
+	bool bLastSeekSucceeded = false;
 };
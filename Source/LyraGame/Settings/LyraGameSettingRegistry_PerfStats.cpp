@@ -26,7 +26,7 @@ void ULyraGameSettingRegistry::AddPerformanceStatPage(UGameSettingCollection* Pe
 {
 	//----------------------------------------------------------------------------------
 	{
-		static_assert((int32)ELyraDisplayablePerformanceStat::Count == 15, "Consider updating this function to deal with new performance stats");
+		static_assert((int32)ELyraDisplayablePerformanceStat::Count == 17, "Consider updating this function to deal with new performance stats");
 
 		UGameSettingCollectionPage* StatsPage = NewObject<UGameSettingCollectionPage>();
 		StatsPage->SetDevName(TEXT("PerfStatsPage"));
@@ -111,6 +111,22 @@ void ULyraGameSettingRegistry::AddPerformanceStatPage(UGameSettingCollection* Pe
 				StatCategory_Performance->AddSetting(Setting);
 			}
 			//----------------------------------------------------------------------------------
+			{
+				ULyraSettingValueDiscrete_PerfStat* Setting = NewObject<ULyraSettingValueDiscrete_PerfStat>();
+				Setting->SetStat(ELyraDisplayablePerformanceStat::GameplayCueHitRate);
+				Setting->SetDisplayName(LOCTEXT("PerfStat_GameplayCueHitRate", "Gameplay Cue Hit Rate"));
+				Setting->SetDescriptionRichText(LOCTEXT("PerfStatDescription_GameplayCueHitRate", "The percentage of gameplay cues that were already loaded when they were played."));
+				StatCategory_Performance->AddSetting(Setting);
+			}
+			//----------------------------------------------------------------------------------
+			{
+				ULyraSettingValueDiscrete_PerfStat* Setting = NewObject<ULyraSettingValueDiscrete_PerfStat>();
+				Setting->SetStat(ELyraDisplayablePerformanceStat::GameplayCueLateLoads);
+				Setting->SetDisplayName(LOCTEXT("PerfStat_GameplayCueLateLoads", "Late Gameplay Cues"));
+				Setting->SetDescriptionRichText(LOCTEXT("PerfStatDescription_GameplayCueLateLoads", "The number of gameplay cues that had to be loaded when they were played."));
+				StatCategory_Performance->AddSetting(Setting);
+			}
+			//----------------------------------------------------------------------------------
 		}
 
 		// Network stats
@@ -10,6 +10,8 @@
 #include "Engine/Engine.h"
 #include "AbilitySystem/LyraGameplayCueManager.h"
 #include "Misc/ScopedSlowTask.h"
+#include "Tasks/Task.h"
+#include "Algo/AllOf.h"
 
 const FName FLyraBundles::Equipped("Equipped");
 
@@ -23,7 +25,7 @@ static FAutoConsoleCommand CVarDumpLoadedAssets(
 
 //////////////////////////////////////////////////////////////////////
 
-#define STARTUP_JOB_WEIGHTED(JobFunc, JobWeight) StartupJobs.Add(FLyraAssetManagerStartupJob(#JobFunc, [this](const FLyraAssetManagerStartupJob& StartupJob, TSharedPtr<FStreamableHandle>& LoadHandle){JobFunc;}, JobWeight))
+#define STARTUP_JOB_WEIGHTED(JobFunc, JobWeight) StartupJobs.Add_GetRef(FLyraAssetManagerStartupJob(#JobFunc, [this](const FLyraAssetManagerStartupJob& StartupJob, TSharedPtr<FStreamableHandle>& LoadHandle){JobFunc;}, JobWeight))
 #define STARTUP_JOB(JobFunc) STARTUP_JOB_WEIGHTED(JobFunc, 1.f)
 
 //////////////////////////////////////////////////////////////////////
@@ -107,11 +109,14 @@ void ULyraAssetManager::StartInitialLoading()
 	Super::StartInitialLoading();
 
 	STARTUP_JOB(InitializeAbilitySystem());
-	STARTUP_JOB(InitializeGameplayCueManager());
+	STARTUP_JOB(InitializeGameplayCueManager())
+		.DependsOn(TEXT("InitializeAbilitySystem()"));
 
 	{
-		// Load base game data asset
-		STARTUP_JOB_WEIGHTED(GetGameData(), 25.f);
+		// Load base game data asset, streaming it in while the gameplay cue manager initializes
+		STARTUP_JOB_WEIGHTED(GetGameData(), 25.f)
+			.DependsOn(TEXT("InitializeAbilitySystem()"))
+			.PreloadPrimaryAssetType(ULyraGameData::StaticClass()->GetFName());
 	}
 
 	// Run all the queued up startup jobs
@@ -201,27 +206,102 @@ void ULyraAssetManager::DoAllStartupJobs()
 	SCOPED_BOOT_TIMING("ULyraAssetManager::DoAllStartupJobs");
 	const double AllStartupJobsStartTime = FPlatformTime::Seconds();
 
-	if (IsRunningDedicatedServer())
+	// No need for periodic progress updates on a dedicated server, just run the jobs
+	const bool bReportProgress = !IsRunningDedicatedServer();
+
+	if (StartupJobs.Num() > 0)
 	{
-		// No need for periodic progress updates, just run the jobs
+		TArray<TArray<int32>> JobDependencies;
+		TArray<int32> JobOrder;
+		SortStartupJobs(JobOrder, JobDependencies);
+
+		float TotalJobValue = 0.0f;
 		for (const FLyraAssetManagerStartupJob& StartupJob : StartupJobs)
 		{
-			StartupJob.DoJob();
+			TotalJobValue += StartupJob.JobWeight;
 		}
-	}
-	else
-	{
-		if (StartupJobs.Num() > 0)
+
+		TArray<UE::Tasks::FTask> JobTasks;
+		JobTasks.SetNum(StartupJobs.Num());
+
+		TBitArray<> FinishedJobs(false, StartupJobs.Num());
+		TBitArray<> PreloadedJobs(false, StartupJobs.Num());
+		TArray<TSharedPtr<FStreamableHandle>> PreloadHandles;
+
+		auto IsJobFinished = [&](int32 JobIndex)
+		{
+			return FinishedJobs[JobIndex] || (JobTasks[JobIndex].IsValid() && JobTasks[JobIndex].IsCompleted());
+		};
+
+		// Gathers the preloads of every job that became runnable and starts them all as a single request
+		auto IssueReadyPreloads = [&]()
 		{
-			float TotalJobValue = 0.0f;
-			for (const FLyraAssetManagerStartupJob& StartupJob : StartupJobs)
+			TArray<FPrimaryAssetId> AssetsToLoad;
+			for (int32 JobIndex = 0; JobIndex < StartupJobs.Num(); ++JobIndex)
 			{
-				TotalJobValue += StartupJob.JobWeight;
+				if (PreloadedJobs[JobIndex] || !Algo::AllOf(JobDependencies[JobIndex], IsJobFinished))
+				{
+					continue;
+				}
+
+				PreloadedJobs[JobIndex] = true;
+				for (const FPrimaryAssetType& AssetType : StartupJobs[JobIndex].PreloadPrimaryAssetTypes)
+				{
+					TArray<FPrimaryAssetId> AssetIds;
+					GetPrimaryAssetIdList(AssetType, AssetIds);
+					AssetsToLoad.Append(AssetIds);
+				}
 			}
 
-			float AccumulatedJobValue = 0.0f;
-			for (FLyraAssetManagerStartupJob& StartupJob : StartupJobs)
+			if (AssetsToLoad.Num() > 0)
 			{
+				UE_LOG(LogLyra, Display, TEXT("Startup jobs preloading %d primary assets in a single batch"), AssetsToLoad.Num());
+				PreloadHandles.Add(LoadPrimaryAssets(AssetsToLoad, TArray<FName>(), FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority));
+			}
+		};
+
+		auto UpdateFinishedJobProgress = [&]()
+		{
+			float FinishedJobValue = 0.0f;
+			for (int32 JobIndex = 0; JobIndex < StartupJobs.Num(); ++JobIndex)
+			{
+				if (IsJobFinished(JobIndex))
+				{
+					FinishedJobValue += StartupJobs[JobIndex].JobWeight;
+				}
+			}
+			UpdateInitialGameContentLoadPercent(FinishedJobValue / TotalJobValue);
+			return FinishedJobValue;
+		};
+
+		IssueReadyPreloads();
+
+		// Jobs are visited in dependency order. Thread safe jobs are launched as tasks that wait on their thread safe
+		// prerequisites, game thread jobs run inline once any task they depend on has completed.
+		for (const int32 JobIndex : JobOrder)
+		{
+			FLyraAssetManagerStartupJob& StartupJob = StartupJobs[JobIndex];
+
+			TArray<UE::Tasks::FTask> Prerequisites;
+			for (const int32 DependencyIndex : JobDependencies[JobIndex])
+			{
+				if (JobTasks[DependencyIndex].IsValid())
+				{
+					Prerequisites.Add(JobTasks[DependencyIndex]);
+				}
+			}
+
+			if (StartupJob.ThreadAffinity == ELyraStartupJobThread::AnyThread)
+			{
+				JobTasks[JobIndex] = UE::Tasks::Launch(*StartupJob.JobName, [&StartupJob]() { StartupJob.DoJob(); }, Prerequisites);
+				continue;
+			}
+
+			UE::Tasks::Wait(Prerequisites);
+
+			if (bReportProgress)
+			{
+				const float AccumulatedJobValue = UpdateFinishedJobProgress();
 				const float JobValue = StartupJob.JobWeight;
 				StartupJob.SubstepProgressDelegate.BindLambda([This = this, AccumulatedJobValue, JobValue, TotalJobValue](float NewProgress)
 					{
@@ -230,20 +310,27 @@ void ULyraAssetManager::DoAllStartupJobs()
 
 						This->UpdateInitialGameContentLoadPercent(OverallPercentWithSubstep);
 					});
+			}
 
-				StartupJob.DoJob();
+			StartupJob.DoJob();
+			StartupJob.SubstepProgressDelegate.Unbind();
+			FinishedJobs[JobIndex] = true;
 
-				StartupJob.SubstepProgressDelegate.Unbind();
+			IssueReadyPreloads();
+		}
 
-				AccumulatedJobValue += JobValue;
+		UE::Tasks::Wait(JobTasks.FilterByPredicate([](const UE::Tasks::FTask& Task) { return Task.IsValid(); }));
 
-				UpdateInitialGameContentLoadPercent(AccumulatedJobValue / TotalJobValue);
-			}
-		}
-		else
+		if (bReportProgress)
 		{
 			UpdateInitialGameContentLoadPercent(1.0f);
 		}
+
+		LogStartupJobsCriticalPath(JobOrder, JobDependencies, FPlatformTime::Seconds() - AllStartupJobsStartTime);
+	}
+	else if (bReportProgress)
+	{
+		UpdateInitialGameContentLoadPercent(1.0f);
 	}
 
 	StartupJobs.Empty();
@@ -251,6 +338,109 @@ void ULyraAssetManager::DoAllStartupJobs()
 	UE_LOG(LogLyra, Display, TEXT("All startup jobs took %.2f seconds to complete"), FPlatformTime::Seconds() - AllStartupJobsStartTime);
 }
 
+void ULyraAssetManager::SortStartupJobs(TArray<int32>& OutJobOrder, TArray<TArray<int32>>& OutJobDependencies) const
+{
+	const int32 NumJobs = StartupJobs.Num();
+
+	TMap<FString, int32> JobNameToIndex;
+	for (int32 JobIndex = 0; JobIndex < NumJobs; ++JobIndex)
+	{
+		JobNameToIndex.Add(StartupJobs[JobIndex].JobName, JobIndex);
+	}
+
+	OutJobDependencies.SetNum(NumJobs);
+	for (int32 JobIndex = 0; JobIndex < NumJobs; ++JobIndex)
+	{
+		for (const FString& DependencyName : StartupJobs[JobIndex].Dependencies)
+		{
+			if (const int32* DependencyIndex = JobNameToIndex.Find(DependencyName))
+			{
+				OutJobDependencies[JobIndex].AddUnique(*DependencyIndex);
+			}
+			else
+			{
+				UE_LOG(LogLyra, Warning, TEXT("Startup job \"%s\" depends on unknown job \"%s\", ignoring the dependency"), *StartupJobs[JobIndex].JobName, *DependencyName);
+			}
+		}
+	}
+
+	// Stable topological sort, jobs keep the order they were added in unless a dependency says otherwise
+	OutJobOrder.Reset(NumJobs);
+	TBitArray<> Scheduled(false, NumJobs);
+	bool bMadeProgress = true;
+	while (OutJobOrder.Num() < NumJobs && bMadeProgress)
+	{
+		bMadeProgress = false;
+		for (int32 JobIndex = 0; JobIndex < NumJobs; ++JobIndex)
+		{
+			if (!Scheduled[JobIndex] && Algo::AllOf(OutJobDependencies[JobIndex], [&Scheduled](int32 DependencyIndex) { return Scheduled[DependencyIndex]; }))
+			{
+				Scheduled[JobIndex] = true;
+				OutJobOrder.Add(JobIndex);
+				bMadeProgress = true;
+			}
+		}
+	}
+
+	if (OutJobOrder.Num() < NumJobs)
+	{
+		// A cycle, fall back to running the remaining jobs one after another in the order they were added
+		for (int32 JobIndex = 0; JobIndex < NumJobs; ++JobIndex)
+		{
+			if (!Scheduled[JobIndex])
+			{
+				UE_LOG(LogLyra, Error, TEXT("Startup job \"%s\" is part of a dependency cycle, running it serially"), *StartupJobs[JobIndex].JobName);
+				OutJobDependencies[JobIndex] = OutJobOrder;
+				OutJobOrder.Add(JobIndex);
+			}
+		}
+	}
+}
+
+void ULyraAssetManager::LogStartupJobsCriticalPath(const TArray<int32>& JobOrder, const TArray<TArray<int32>>& JobDependencies, double WallTime) const
+{
+	// Longest chain of dependent jobs, this is the minimum amount of time startup can take no matter how much runs in parallel
+	TArray<double> PathDuration;
+	TArray<int32> PathPredecessor;
+	PathDuration.SetNumZeroed(StartupJobs.Num());
+	PathPredecessor.Init(INDEX_NONE, StartupJobs.Num());
+
+	double TotalJobTime = 0.0;
+	int32 CriticalPathEnd = INDEX_NONE;
+	for (const int32 JobIndex : JobOrder)
+	{
+		for (const int32 DependencyIndex : JobDependencies[JobIndex])
+		{
+			if (PathPredecessor[JobIndex] == INDEX_NONE || PathDuration[DependencyIndex] > PathDuration[PathPredecessor[JobIndex]])
+			{
+				PathPredecessor[JobIndex] = DependencyIndex;
+			}
+		}
+
+		const double JobDuration = StartupJobs[JobIndex].GetDuration();
+		PathDuration[JobIndex] = JobDuration + ((PathPredecessor[JobIndex] != INDEX_NONE) ? PathDuration[PathPredecessor[JobIndex]] : 0.0);
+		TotalJobTime += JobDuration;
+
+		if (CriticalPathEnd == INDEX_NONE || PathDuration[JobIndex] > PathDuration[CriticalPathEnd])
+		{
+			CriticalPathEnd = JobIndex;
+		}
+	}
+
+	TArray<int32> CriticalPath;
+	for (int32 JobIndex = CriticalPathEnd; JobIndex != INDEX_NONE; JobIndex = PathPredecessor[JobIndex])
+	{
+		CriticalPath.Insert(JobIndex, 0);
+	}
+
+	UE_LOG(LogLyra, Display, TEXT("Startup jobs critical path: %.2f seconds (%.2f seconds wall time, %.2f seconds of job time)"), PathDuration[CriticalPathEnd], WallTime, TotalJobTime);
+	for (const int32 JobIndex : CriticalPath)
+	{
+		const FLyraAssetManagerStartupJob& StartupJob = StartupJobs[JobIndex];
+		UE_LOG(LogLyra, Display, TEXT("    %s: %.2f seconds (started at +%.2f)"), *StartupJob.JobName, StartupJob.GetDuration(), StartupJob.StartTime - StartupJobs[JobOrder[0]].StartTime);
+	}
+}
+
 void ULyraAssetManager::UpdateInitialGameContentLoadPercent(float GameContentPercent)
 {
 	// Could route this to the early startup loading screen
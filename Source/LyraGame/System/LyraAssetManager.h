@@ -94,9 +94,15 @@ protected:
 	TSoftObjectPtr<ULyraPawnData> DefaultPawnData;
 
 private:
-	// Flushes the StartupJobs array. Processes all startup work.
+	// Flushes the StartupJobs array. Processes all startup work, running independent jobs in parallel.
 	void DoAllStartupJobs();
 
+	// Resolves job dependencies by name and orders the jobs so every job comes after the jobs it depends on
+	void SortStartupJobs(TArray<int32>& OutJobOrder, TArray<TArray<int32>>& OutJobDependencies) const;
+
+	// Logs the longest chain of dependent startup jobs along with how long each of them took
+	void LogStartupJobsCriticalPath(const TArray<int32>& JobOrder, const TArray<TArray<int32>>& JobDependencies, double WallTime) const;
+
 	// Sets up the ability system
 	void InitializeAbilitySystem();
 	void InitializeGameplayCueManager();
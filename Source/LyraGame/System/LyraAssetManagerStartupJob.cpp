@@ -5,7 +5,7 @@
 
 TSharedPtr<FStreamableHandle> FLyraAssetManagerStartupJob::DoJob() const
 {
-	const double JobStartTime = FPlatformTime::Seconds();
+	StartTime = FPlatformTime::Seconds();
 
 	TSharedPtr<FStreamableHandle> Handle;
 	UE_LOG(LogLyra, Display, TEXT("Startup job \"%s\" starting"), *JobName);
@@ -13,12 +13,17 @@ TSharedPtr<FStreamableHandle> FLyraAssetManagerStartupJob::DoJob() const
 
 	if (Handle.IsValid())
 	{
+		// Streamable handles can only be waited on from the game thread
+		check(IsInGameThread());
+
 		Handle->BindUpdateDelegate(FStreamableUpdateDelegate::CreateRaw(this, &FLyraAssetManagerStartupJob::UpdateSubstepProgressFromStreamable));
 		Handle->WaitUntilComplete(0.0f, false);
 		Handle->BindUpdateDelegate(FStreamableUpdateDelegate());
 	}
 
-	UE_LOG(LogLyra, Display, TEXT("Startup job \"%s\" took %.2f seconds to complete"), *JobName, FPlatformTime::Seconds() - JobStartTime);
+	EndTime = FPlatformTime::Seconds();
+
+	UE_LOG(LogLyra, Display, TEXT("Startup job \"%s\" took %.2f seconds to complete"), *JobName, GetDuration());
 
 	return Handle;
 }
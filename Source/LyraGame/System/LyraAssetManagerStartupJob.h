@@ -4,9 +4,20 @@
 
 #include "CoreMinimal.h"
 #include "Engine/StreamableManager.h"
+#include "UObject/PrimaryAssetId.h"
 
 DECLARE_DELEGATE_OneParam(FLyraAssetManagerStartupJobSubstepProgress, float /*NewProgress*/);
 
+/** Which threads a startup job is allowed to run on */
+enum class ELyraStartupJobThread : uint8
+{
+	// Touches UObjects or the streamable manager, must run on the game thread
+	GameThread,
+
+	// Thread safe, will be launched as a task as soon as its dependencies are complete
+	AnyThread
+};
+
 /** Handles reporting progress from streamable handles */
 struct FLyraAssetManagerStartupJob
 {
@@ -16,6 +27,18 @@ struct FLyraAssetManagerStartupJob
 	float JobWeight;
 	mutable double LastUpdate = 0;
 
+	// Names of the jobs that need to be complete before this job can start
+	TArray<FString> Dependencies;
+
+	// Primary asset types this job will load, batched with other runnable jobs into a single async request
+	TArray<FPrimaryAssetType> PreloadPrimaryAssetTypes;
+
+	ELyraStartupJobThread ThreadAffinity = ELyraStartupJobThread::GameThread;
+
+	// Wall clock time the job started and finished, filled in by DoJob
+	mutable double StartTime = 0.0;
+	mutable double EndTime = 0.0;
+
 	/** Simple job that is all synchronous */
 	FLyraAssetManagerStartupJob(const FString& InJobName, const TFunction<void(const FLyraAssetManagerStartupJob&, TSharedPtr<FStreamableHandle>&)>& InJobFunc, float InJobWeight)
 		: JobFunc(InJobFunc)
@@ -23,6 +46,32 @@ struct FLyraAssetManagerStartupJob
 		, JobWeight(InJobWeight)
 	{}
 
+	/** Adds a job that must be complete before this one can start */
+	FLyraAssetManagerStartupJob& DependsOn(const FString& InJobName)
+	{
+		Dependencies.AddUnique(InJobName);
+		return *this;
+	}
+
+	/** Marks the job as thread safe so it can run in parallel with other jobs */
+	FLyraAssetManagerStartupJob& RunOnAnyThread()
+	{
+		ThreadAffinity = ELyraStartupJobThread::AnyThread;
+		return *this;
+	}
+
+	/** Starts loading all primary assets of the given type as soon as the job's dependencies are met */
+	FLyraAssetManagerStartupJob& PreloadPrimaryAssetType(FPrimaryAssetType AssetType)
+	{
+		PreloadPrimaryAssetTypes.AddUnique(AssetType);
+		return *this;
+	}
+
+	double GetDuration() const
+	{
+		return EndTime - StartTime;
+	}
+
 	/** Perform actual loading, will return a handle if it created one */
 	TSharedPtr<FStreamableHandle> DoJob() const;
 
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "LyraGameEngine.h"
+#include "Replays/LyraReplaySubsystem.h"
 
 
 ULyraGameEngine::ULyraGameEngine(const FObjectInitializer& ObjectInitializer)
@@ -12,3 +13,9 @@ void ULyraGameEngine::Init(IEngineLoop* InEngineLoop)
 {
 	Super::Init(InEngineLoop);
 }
+
+bool ULyraGameEngine::Experimental_ShouldPreDuplicateMap(const FName MapName) const
+{
+	// The killcam plays back into the duplicated levels
+	return ULyraReplaySubsystem::ShouldDuplicateLevelsForKillcam() || Super::Experimental_ShouldPreDuplicateMap(MapName);
+}
@@ -19,4 +19,8 @@ public:
 protected:
 
 	virtual void Init(IEngineLoop* InEngineLoop) override;
+
+public:
+
+	virtual bool Experimental_ShouldPreDuplicateMap(const FName MapName) const override;
 };
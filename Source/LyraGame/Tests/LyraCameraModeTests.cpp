@@ -0,0 +1,40 @@
+// Copyright Epic Games, Inc.All Rights Reserved.
+
+#include "Camera/LyraCameraMode_ThirdPerson.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLyraCameraFeelerBlockedPctTest, "LyraGame.Camera.ThirdPerson.FeelerBlockedPct", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLyraCameraFeelerBlockedPctTest::RunTest(const FString& Parameters)
+{
+	using ThisCameraMode = ULyraCameraMode_ThirdPerson;
+
+	const FVector Start(100.0, -50.0, 20.0);
+	const FVector Direction = FVector(1.0, 2.0, -0.5).GetSafeNormal();
+	const FVector End = Start + (Direction * 400.0);
+
+	// The feeler's blocked percentage is where along the ray it hit, pulled in by the push out distance
+	TestEqual(TEXT("A hit at the end of the ray doesn't block"), ThisCameraMode::ComputeFeelerBlockedPct(Start, End, End, 0.f), 1.f, KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("A hit halfway along the ray blocks half of it"), ThisCameraMode::ComputeFeelerBlockedPct(Start, End, Start + (Direction * 200.0), 0.f), 0.5f, KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("The push out distance pulls the camera further in"), ThisCameraMode::ComputeFeelerBlockedPct(Start, End, Start + (Direction * 200.0), 40.f), 0.4f, KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("Only the distance along the ray matters, not its direction"),
+		ThisCameraMode::ComputeFeelerBlockedPct(End, Start, End - (Direction * 100.0), 0.f),
+		ThisCameraMode::ComputeFeelerBlockedPct(Start, End, Start + (Direction * 100.0), 0.f), KINDA_SMALL_NUMBER);
+
+	// The blocked percentage found this frame is blended into the camera's current one
+	const float DeltaTime = 0.1f;
+	const float BlendInTime = 0.5f;
+	const float BlendOutTime = 1.0f;
+
+	TestEqual(TEXT("A reset snaps to this frame's result"), ThisCameraMode::BlendDistBlockedPct(1.f, 0.3f, 0.3f, 0.3f, DeltaTime, BlendInTime, BlendOutTime, true), 0.3f, KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("An unblocked ray blends out over BlendOutTime"), ThisCameraMode::BlendDistBlockedPct(0.5f, 1.f, 1.f, 1.f, DeltaTime, BlendInTime, BlendOutTime, false), 0.55f, KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("A main ray hit snaps in"), ThisCameraMode::BlendDistBlockedPct(1.f, 0.4f, 0.4f, 0.8f, DeltaTime, BlendInTime, BlendOutTime, false), 0.4f, KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("A predictive feeler hit blends in over BlendInTime"), ThisCameraMode::BlendDistBlockedPct(1.f, 0.5f, 1.f, 0.5f, DeltaTime, BlendInTime, BlendOutTime, false), 0.9f, KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("A push out past the start of the ray is clamped"), ThisCameraMode::BlendDistBlockedPct(1.f, ThisCameraMode::ComputeFeelerBlockedPct(Start, End, Start, 40.f), 0.f, 0.f, DeltaTime, BlendInTime, BlendOutTime, true), 0.f, KINDA_SMALL_NUMBER);
+
+	return true;
+}
+
+#endif
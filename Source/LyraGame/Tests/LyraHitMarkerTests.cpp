@@ -0,0 +1,132 @@
+// Copyright Epic Games, Inc.All Rights Reserved.
+
+#include "Weapons/LyraWeaponStateComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLyraScreenSpaceHitLocationRingTest, "LyraGame.Weapons.HitMarkers.Ring", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLyraScreenSpaceHitLocationRingTest::RunTest(const FString& Parameters)
+{
+	using FRing = FLyraScreenSpaceHitLocationRing;
+
+	// Every hit gets a unique X so the test can tell the order they came in
+	auto MakeHit = [](int32 Sequence)
+	{
+		FLyraScreenSpaceHitLocation Hit;
+		Hit.Location = FVector2D((float)Sequence, 0.0f);
+		Hit.bShowAsSuccess = true;
+		return Hit;
+	};
+
+	FRing Ring;
+	TestEqual(TEXT("A new ring is empty"), Ring.Num(), 0);
+
+	for (int32 Sequence = 0; Sequence < FRing::Capacity - 1; Sequence++)
+	{
+		Ring.Add(MakeHit(Sequence));
+	}
+	TestEqual(TEXT("Entries are kept until the ring is full"), Ring.Num(), FRing::Capacity - 1);
+	TestEqual(TEXT("Index 0 is the oldest entry before wrapping"), (int32)Ring[0].Location.X, 0);
+
+	int32 NumAdded = FRing::Capacity - 1;
+	for (; NumAdded < 1000; NumAdded++)
+	{
+		Ring.Add(MakeHit(NumAdded));
+	}
+	TestEqual(TEXT("A full ring stays at capacity"), Ring.Num(), FRing::Capacity);
+
+	int32 ExpectedSequence = NumAdded - FRing::Capacity;
+	bool bInOrder = true;
+	for (const FLyraScreenSpaceHitLocation& Hit : Ring)
+	{
+		bInOrder &= ((int32)Hit.Location.X == ExpectedSequence++);
+	}
+	TestTrue(TEXT("Iteration visits the most recent entries, oldest first"), bInOrder);
+	TestEqual(TEXT("Iteration visits every entry"), ExpectedSequence, NumAdded);
+
+	Ring.Reset();
+	TestEqual(TEXT("Reset empties the ring"), Ring.Num(), 0);
+	TestFalse(TEXT("An empty ring has nothing to iterate"), Ring.begin() != Ring.end());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLyraHitMarkerConfirmationTest, "LyraGame.Weapons.HitMarkers.Confirmation", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLyraHitMarkerConfirmationTest::RunTest(const FString& Parameters)
+{
+	const int32 NumConfirmations = 1000;
+
+	// About as many shots as a fast weapon has waiting on the server at once
+	const int32 NumBatchesInFlight = 8;
+
+	// Confirming a hit stamps the damage instigated time, so the component needs a world
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, /*bInformEngineOfWorld=*/ false);
+	AActor* Owner = World->SpawnActor<AActor>();
+	ULyraWeaponStateComponent* WeaponState = NewObject<ULyraWeaponStateComponent>(Owner);
+
+	const SIZE_T InitialBatchesSize = WeaponState->UnconfirmedServerSideHitMarkers.GetAllocatedSize();
+
+	TArray<uint8> InFlightIds;
+	InFlightIds.Reserve(NumBatchesInFlight);
+
+	const TArray<uint8> NoHitReplaces;
+	bool bIdsUnique = true;
+	int32 NumSuccessHits = 0;
+	int32 LastSuccessSequence = INDEX_NONE;
+
+	// Each shot has three hits, the last of which didn't damage anything and shouldn't be shown
+	for (int32 ShotIndex = 0; ShotIndex < NumConfirmations; ShotIndex++)
+	{
+		const uint8 BatchId = WeaponState->AllocateHitMarkerBatchId();
+		bIdsUnique &= !InFlightIds.Contains(BatchId);
+		InFlightIds.Add(BatchId);
+
+		FLyraServerSideHitMarkerBatch& Batch = WeaponState->UnconfirmedServerSideHitMarkers.Add(BatchId, FLyraServerSideHitMarkerBatch(BatchId));
+		for (int32 HitIndex = 0; HitIndex < 3; HitIndex++)
+		{
+			// Every hit gets a unique X so the newest confirmed one can be identified
+			FLyraScreenSpaceHitLocation& Hit = Batch.Markers.AddDefaulted_GetRef();
+			Hit.Location = FVector2D((float)((ShotIndex * 3) + HitIndex), 0.0f);
+			Hit.bShowAsSuccess = (HitIndex < 2);
+		}
+
+		if (InFlightIds.Num() == NumBatchesInFlight)
+		{
+			const uint8 ConfirmedId = InFlightIds[0];
+			InFlightIds.RemoveAt(0, 1, /*bAllowShrinking=*/ false);
+
+			WeaponState->ClientConfirmTargetData_Implementation(ConfirmedId, /*bSuccess=*/ true, NoHitReplaces);
+			NumSuccessHits += 2;
+			LastSuccessSequence = (((ShotIndex - NumBatchesInFlight + 1) * 3) + 1);
+		}
+	}
+
+	TestTrue(TEXT("Batch IDs are never handed out while still in flight"), bIdsUnique);
+	TestEqual(TEXT("Only the unconfirmed batches are kept"), WeaponState->GetUnconfirmedServerSideHitMarkerCount(), NumBatchesInFlight - 1);
+	TestTrue(TEXT("Tracking the unconfirmed batches never allocates"), WeaponState->UnconfirmedServerSideHitMarkers.GetAllocatedSize() == InitialBatchesSize);
+
+	const FLyraScreenSpaceHitLocationRing& Locations = WeaponState->GetLastWeaponDamageScreenLocations();
+	TestEqual(TEXT("The confirmed locations are capped at the ring capacity"), Locations.Num(), FMath::Min(NumSuccessHits, FLyraScreenSpaceHitLocationRing::Capacity));
+	if (Locations.Num() > 0)
+	{
+		TestEqual(TEXT("The newest confirmed location is the last successful hit"), (int32)Locations[Locations.Num() - 1].Location.X, LastSuccessSequence);
+	}
+
+	bool bOnlySuccessHits = true;
+	for (const FLyraScreenSpaceHitLocation& Hit : Locations)
+	{
+		bOnlySuccessHits &= Hit.bShowAsSuccess;
+	}
+	TestTrue(TEXT("Only hits shown as a success are confirmed"), bOnlySuccessHits);
+
+	World->DestroyWorld(/*bInformEngineOfWorld=*/ false);
+
+	return true;
+}
+
+#endif
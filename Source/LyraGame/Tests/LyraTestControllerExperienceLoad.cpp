@@ -0,0 +1,128 @@
+// Copyright Epic Games, Inc.All Rights Reserved.
+
+#include "Tests/LyraTestControllerExperienceLoad.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameModes/LyraExperienceManagerComponent.h"
+#include "GameModes/LyraExperiencePrefetchSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "UObject/UObjectGlobals.h"
+#include "Misc/CommandLine.h"
+#include "LyraLogChannels.h"
+
+void ULyraTestControllerExperienceLoad::OnInit()
+{
+	Super::OnInit();
+
+	const TCHAR* CommandLine = FCommandLine::Get();
+	FParse::Value(CommandLine, TEXT("ExperienceLoadMaxSeconds="), MaxLoadSeconds);
+	FParse::Value(CommandLine, TEXT("ExperienceLoadTimeoutSeconds="), TimeoutSeconds);
+	FParse::Value(CommandLine, TEXT("PrefetchSeconds="), PrefetchSeconds);
+	FParse::Value(CommandLine, TEXT("NextExperience="), NextExperience);
+	FParse::Value(CommandLine, TEXT("NextMap="), NextMap);
+	bPrefetchNextExperience &= !FParse::Param(CommandLine, TEXT("NoPrefetch"));
+
+	// Normally replaced when the startup map starts loading, kept in case that already happened
+	PhaseStartTime = FPlatformTime::Seconds();
+	FCoreUObjectDelegates::PreLoadMap.AddUObject(this, &ThisClass::HandlePreLoadMap);
+}
+
+void ULyraTestControllerExperienceLoad::HandlePreLoadMap(const FString& MapName)
+{
+	// Time the first load from the start of the map load rather than from engine startup
+	if ((Phase == EPhase::FirstLoad) && !bFirstMapLoadStarted)
+	{
+		bFirstMapLoadStarted = true;
+		PhaseStartTime = FPlatformTime::Seconds();
+	}
+}
+
+void ULyraTestControllerExperienceLoad::OnTick(float TimeDelta)
+{
+	Super::OnTick(TimeDelta);
+
+	const double PhaseSeconds = FPlatformTime::Seconds() - PhaseStartTime;
+	ULyraExperienceManagerComponent* ExperienceComponent = GetExperienceComponent();
+
+	switch (Phase)
+	{
+	case EPhase::FirstLoad:
+	case EPhase::SecondLoad:
+	{
+		// Wait for the travel to replace the first world before looking at the second load
+		const bool bInExpectedWorld = (Phase == EPhase::FirstLoad) || (GetWorld() != FirstWorld.Get());
+		if (!bInExpectedWorld || (ExperienceComponent == nullptr) || !ExperienceComponent->IsExperienceLoaded())
+		{
+			if ((TimeoutSeconds > 0.0f) && (PhaseSeconds > TimeoutSeconds))
+			{
+				UE_LOG(LogLyra, Error, TEXT("Experience load test: experience did not load within %.1f seconds"), TimeoutSeconds);
+				EndTest(1);
+			}
+			return;
+		}
+
+		const TCHAR* LoadName = (Phase == EPhase::FirstLoad) ? TEXT("first experience") : (bPrefetchNextExperience ? TEXT("prefetched experience") : TEXT("next experience (not prefetched)"));
+		if (!ReportLoad(LoadName, PhaseSeconds))
+		{
+			return;
+		}
+
+		if ((Phase == EPhase::SecondLoad) || NextExperience.IsEmpty())
+		{
+			EndTest(0);
+			return;
+		}
+
+		const FPrimaryAssetId NextExperienceId(FPrimaryAssetType(TEXT("LyraExperienceDefinition")), FName(*NextExperience));
+		if (bPrefetchNextExperience)
+		{
+			UE_LOG(LogLyra, Display, TEXT("Experience load test: prefetching %s for %.1f seconds"), *NextExperienceId.ToString(), PrefetchSeconds);
+			if (ULyraExperiencePrefetchSubsystem* PrefetchSubsystem = UGameInstance::GetSubsystem<ULyraExperiencePrefetchSubsystem>(GetWorld()->GetGameInstance()))
+			{
+				PrefetchSubsystem->PrefetchNextExperience(NextExperienceId);
+			}
+		}
+		else
+		{
+			UE_LOG(LogLyra, Display, TEXT("Experience load test: waiting %.1f seconds, then travelling to %s without prefetching"), PrefetchSeconds, *NextExperienceId.ToString());
+		}
+
+		FirstWorld = GetWorld();
+		Phase = EPhase::Prefetch;
+		PhaseStartTime = FPlatformTime::Seconds();
+		break;
+	}
+
+	case EPhase::Prefetch:
+		if (PhaseSeconds >= PrefetchSeconds)
+		{
+			const FString MapName = NextMap.IsEmpty() ? GetWorld()->GetOutermost()->GetName() : NextMap;
+			GetWorld()->ServerTravel(FString::Printf(TEXT("%s?Experience=%s"), *MapName, *NextExperience));
+
+			Phase = EPhase::SecondLoad;
+			PhaseStartTime = FPlatformTime::Seconds();
+		}
+		break;
+	}
+}
+
+ULyraExperienceManagerComponent* ULyraTestControllerExperienceLoad::GetExperienceComponent() const
+{
+	const UWorld* World = GetWorld();
+	const AGameStateBase* GameState = World ? World->GetGameState() : nullptr;
+	return GameState ? GameState->FindComponentByClass<ULyraExperienceManagerComponent>() : nullptr;
+}
+
+bool ULyraTestControllerExperienceLoad::ReportLoad(const TCHAR* Name, double LoadSeconds)
+{
+	UE_LOG(LogLyra, Display, TEXT("Experience load test: %s loaded in %.2f seconds on %s"), Name, LoadSeconds, *GetNameSafe(GetWorld()));
+
+	if ((MaxLoadSeconds > 0.0f) && (LoadSeconds > MaxLoadSeconds))
+	{
+		UE_LOG(LogLyra, Error, TEXT("Experience load test: %s took %.2f seconds, budget is %.2f"), Name, LoadSeconds, MaxLoadSeconds);
+		EndTest(1);
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,71 @@
+// Copyright Epic Games, Inc.All Rights Reserved.
+
+#pragma once
+
+#include "GauntletTestController.h"
+#include "LyraTestControllerExperienceLoad.generated.h"
+
+class ULyraExperienceManagerComponent;
+
+/**
+ * ULyraTestControllerExperienceLoad
+ *
+ * Measures how long the experience of the startup map takes to load and fails the test if it goes over budget.
+ * With -NextExperience= it then prefetches that experience, travels to it and measures the second load as well,
+ * e.g. -NextExperience=B_ShooterGame_Elimination -NextMap=/ShooterMaps/Maps/L_Expanse
+ * Adding -NoPrefetch travels without prefetching, as the baseline to compare the prefetched load against.
+ * Loads are timed from the start of the map load (or travel) to the experience being fully loaded.
+ */
+UCLASS(Config=Game)
+class ULyraTestControllerExperienceLoad : public UGauntletTestController
+{
+	GENERATED_BODY()
+
+protected:
+	//~UGauntletTestController interface
+	virtual void OnInit() override;
+	virtual void OnTick(float TimeDelta) override;
+	//~End of UGauntletTestController interface
+
+	ULyraExperienceManagerComponent* GetExperienceComponent() const;
+
+	void HandlePreLoadMap(const FString& MapName);
+
+	// Returns false (and ends the test) if the load took longer than the budget
+	bool ReportLoad(const TCHAR* Name, double LoadSeconds);
+
+protected:
+	// Experience loads taking longer than this fail the test (-ExperienceLoadMaxSeconds=), 0 only fails when it times out
+	UPROPERTY(Config)
+	float MaxLoadSeconds = 0.0f;
+
+	// How long to wait for an experience before giving up (-ExperienceLoadTimeoutSeconds=)
+	UPROPERTY(Config)
+	float TimeoutSeconds = 120.0f;
+
+	// How long to let the next experience prefetch before travelling to it (-PrefetchSeconds=)
+	UPROPERTY(Config)
+	float PrefetchSeconds = 10.0f;
+
+	// Prefetch the next experience before travelling to it, turned off by -NoPrefetch for a baseline run
+	UPROPERTY(Config)
+	bool bPrefetchNextExperience = true;
+
+private:
+	enum class EPhase : uint8
+	{
+		FirstLoad,
+		Prefetch,
+		SecondLoad
+	};
+
+	EPhase Phase = EPhase::FirstLoad;
+	double PhaseStartTime = 0.0;
+	bool bFirstMapLoadStarted = false;
+
+	// The experience and map to travel to after the first load (-NextExperience=, -NextMap=)
+	FString NextExperience;
+	FString NextMap;
+
+	TWeakObjectPtr<UWorld> FirstWorld;
+};
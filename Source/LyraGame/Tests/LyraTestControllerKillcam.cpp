@@ -0,0 +1,253 @@
+// Copyright Epic Games, Inc.All Rights Reserved.
+
+#include "Tests/LyraTestControllerKillcam.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameModes/LyraBotCreationComponent.h"
+#include "GameModes/LyraExperienceManagerComponent.h"
+#include "Replays/LyraReplaySubsystem.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/CommandLine.h"
+#include "LyraLogChannels.h"
+
+namespace LyraKillcamTest
+{
+	static double GetUsedMemoryMB()
+	{
+		return FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0);
+	}
+}
+
+void ULyraTestControllerKillcam::OnInit()
+{
+	Super::OnInit();
+
+	const TCHAR* CommandLine = FCommandLine::Get();
+	FParse::Value(CommandLine, TEXT("KillcamBots="), NumBots);
+	FParse::Value(CommandLine, TEXT("KillcamRecordSeconds="), RecordSeconds);
+	FParse::Value(CommandLine, TEXT("KillcamSeeks="), NumSeeks);
+	FParse::Value(CommandLine, TEXT("KillcamTimeoutSeconds="), TimeoutSeconds);
+	FParse::Value(CommandLine, TEXT("KillcamMaxSeekMs="), MaxSeekMs);
+	FParse::Value(CommandLine, TEXT("KillcamMaxRecordMemoryMB="), MaxRecordMemoryMB);
+	FParse::Value(CommandLine, TEXT("KillcamMaxPlaybackMemoryMB="), MaxPlaybackMemoryMB);
+
+	// The killcam plays back into the duplicated levels, which only exist if this is set before the map loads
+	if (IConsoleVariable* DuplicateLevelsCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("Lyra.Killcam.DuplicateLevels")))
+	{
+		DuplicateLevelsCVar->Set(true);
+	}
+
+	// Same seek times on every run, so runs can be compared
+	SeekStream.Initialize(0x4b494c4c);
+
+	PhaseStartTime = FPlatformTime::Seconds();
+
+	UE_LOG(LogLyra, Display, TEXT("Killcam test: %d bots, %.1f seconds recorded, %d seeks (budgets: %.1f ms per seek, %.0f MB recording, %.0f MB playback)"),
+		NumBots, RecordSeconds, NumSeeks, MaxSeekMs, MaxRecordMemoryMB, MaxPlaybackMemoryMB);
+}
+
+void ULyraTestControllerKillcam::OnTick(float TimeDelta)
+{
+	Super::OnTick(TimeDelta);
+
+	const double PhaseSeconds = FPlatformTime::Seconds() - PhaseStartTime;
+
+	switch (Phase)
+	{
+	case EPhase::WaitForExperience:
+		if (IsExperienceLoaded())
+		{
+			StartRecording();
+		}
+		else if ((TimeoutSeconds > 0.0f) && (PhaseSeconds > TimeoutSeconds))
+		{
+			UE_LOG(LogLyra, Error, TEXT("Killcam test: experience did not load within %.1f seconds"), TimeoutSeconds);
+			EndTest(1);
+		}
+		break;
+
+	case EPhase::Recording:
+		SampleMemory();
+		if (!ReplaySubsystem->IsRecordingKillcam())
+		{
+			UE_LOG(LogLyra, Error, TEXT("Killcam test: the killcam recording stopped after %.1f seconds"), PhaseSeconds);
+			EndTest(1);
+		}
+		else if (PhaseSeconds >= RecordSeconds)
+		{
+			StartPlayback();
+		}
+		break;
+
+	case EPhase::WaitForPlayback:
+		SampleMemory();
+		if (ReplaySubsystem->IsPlayingKillcam() && (ReplaySubsystem->GetReplayLengthInSeconds() > 0.0f))
+		{
+			UE_LOG(LogLyra, Display, TEXT("Killcam test: playback started after %.2f seconds, %.1f seconds of killcam"), PhaseSeconds, ReplaySubsystem->GetReplayLengthInSeconds());
+			Phase = EPhase::Seeking;
+			PhaseStartTime = FPlatformTime::Seconds();
+		}
+		else if ((TimeoutSeconds > 0.0f) && (PhaseSeconds > TimeoutSeconds))
+		{
+			UE_LOG(LogLyra, Error, TEXT("Killcam test: playback did not start within %.1f seconds"), TimeoutSeconds);
+			EndTest(1);
+		}
+		break;
+
+	case EPhase::Seeking:
+		SampleMemory();
+		TickSeeks();
+		break;
+	}
+}
+
+bool ULyraTestControllerKillcam::IsExperienceLoaded() const
+{
+	const UWorld* World = GetWorld();
+	const AGameStateBase* GameState = World ? World->GetGameState() : nullptr;
+	const ULyraExperienceManagerComponent* ExperienceComponent = GameState ? GameState->FindComponentByClass<ULyraExperienceManagerComponent>() : nullptr;
+	return ExperienceComponent && ExperienceComponent->IsExperienceLoaded();
+}
+
+void ULyraTestControllerKillcam::StartRecording()
+{
+	UWorld* World = GetWorld();
+
+#if WITH_SERVER_CODE
+	if (ULyraBotCreationComponent* BotComponent = World->GetGameState()->FindComponentByClass<ULyraBotCreationComponent>())
+	{
+		BotComponent->QueueBotSpawns(NumBots);
+	}
+	else
+	{
+		UE_LOG(LogLyra, Warning, TEXT("Killcam test: the experience has no bot creation component, recording without additional bots"));
+	}
+#endif
+
+	ReplaySubsystem = World->GetGameInstance()->GetSubsystem<ULyraReplaySubsystem>();
+	if (ReplaySubsystem == nullptr)
+	{
+		UE_LOG(LogLyra, Error, TEXT("Killcam test: no replay subsystem"));
+		EndTest(1);
+		return;
+	}
+
+	BaselineMemoryMB = LyraKillcamTest::GetUsedMemoryMB();
+
+	ReplaySubsystem->StartKillcamRecording();
+	if (!ReplaySubsystem->IsRecordingKillcam())
+	{
+		UE_LOG(LogLyra, Error, TEXT("Killcam test: failed to start the killcam recording"));
+		EndTest(1);
+		return;
+	}
+
+	UE_LOG(LogLyra, Display, TEXT("Killcam test: recording on %s, %.1f MB used before recording"), *GetNameSafe(World), BaselineMemoryMB);
+
+	Phase = EPhase::Recording;
+	PhaseStartTime = FPlatformTime::Seconds();
+}
+
+void ULyraTestControllerKillcam::StartPlayback()
+{
+	UE_LOG(LogLyra, Display, TEXT("Killcam test: recorded %.1f seconds, peak %.1f MB above baseline"), FPlatformTime::Seconds() - PhaseStartTime, PeakRecordMemoryMB);
+
+	ReplaySubsystem->PlayKillcamReplay();
+	if (!ReplaySubsystem->IsPlayingKillcam())
+	{
+		UE_LOG(LogLyra, Error, TEXT("Killcam test: failed to start killcam playback"));
+		EndTest(1);
+		return;
+	}
+
+	Phase = EPhase::WaitForPlayback;
+	PhaseStartTime = FPlatformTime::Seconds();
+}
+
+void ULyraTestControllerKillcam::TickSeeks()
+{
+	if (bWaitingForSeek)
+	{
+		if (ReplaySubsystem->IsSeekInProgress())
+		{
+			if ((TimeoutSeconds > 0.0f) && (FPlatformTime::Seconds() - PhaseStartTime > TimeoutSeconds))
+			{
+				UE_LOG(LogLyra, Error, TEXT("Killcam test: seek %d did not complete within %.1f seconds"), SeekDurationsMs.Num() + NumFailedSeeks + 1, TimeoutSeconds);
+				EndTest(1);
+			}
+			return;
+		}
+
+		bWaitingForSeek = false;
+		if (ReplaySubsystem->WasLastSeekSuccessful())
+		{
+			SeekDurationsMs.Add(ReplaySubsystem->GetLastSeekDuration() * 1000.0);
+		}
+		else
+		{
+			++NumFailedSeeks;
+		}
+	}
+
+	if ((SeekDurationsMs.Num() + NumFailedSeeks) >= NumSeeks)
+	{
+		FinishTest();
+		return;
+	}
+
+	if (!ReplaySubsystem->IsPlayingKillcam())
+	{
+		UE_LOG(LogLyra, Error, TEXT("Killcam test: killcam playback stopped during the seeks"));
+		EndTest(1);
+		return;
+	}
+
+	ReplaySubsystem->FastSeekInActiveReplay(SeekStream.FRandRange(0.0f, ReplaySubsystem->GetReplayLengthInSeconds()));
+	bWaitingForSeek = true;
+	PhaseStartTime = FPlatformTime::Seconds();
+}
+
+void ULyraTestControllerKillcam::SampleMemory()
+{
+	const double UsedMB = LyraKillcamTest::GetUsedMemoryMB() - BaselineMemoryMB;
+	double& PeakMB = (Phase == EPhase::Recording) ? PeakRecordMemoryMB : PeakPlaybackMemoryMB;
+	PeakMB = FMath::Max(PeakMB, UsedMB);
+}
+
+void ULyraTestControllerKillcam::FinishTest()
+{
+	ReplaySubsystem->StopKillcamPlayback();
+	ReplaySubsystem->StopKillcamRecording();
+
+	SeekDurationsMs.Sort();
+	const double SlowestSeekMs = (SeekDurationsMs.Num() > 0) ? SeekDurationsMs.Last() : 0.0;
+	const double MedianSeekMs = (SeekDurationsMs.Num() > 0) ? SeekDurationsMs[SeekDurationsMs.Num() / 2] : 0.0;
+
+	UE_LOG(LogLyra, Display, TEXT("Killcam test results:"));
+	UE_LOG(LogLyra, Display, TEXT("    Seeks: %d completed, %d failed, median %.2f ms, slowest %.2f ms"), SeekDurationsMs.Num(), NumFailedSeeks, MedianSeekMs, SlowestSeekMs);
+	UE_LOG(LogLyra, Display, TEXT("    Memory above baseline: peak %.1f MB recording, peak %.1f MB playback"), PeakRecordMemoryMB, PeakPlaybackMemoryMB);
+
+	int32 NumFailures = 0;
+	if (NumFailedSeeks > 0)
+	{
+		UE_LOG(LogLyra, Error, TEXT("Killcam test: %d seek(s) failed"), NumFailedSeeks);
+		++NumFailures;
+	}
+
+	auto CheckBudget = [&NumFailures](const TCHAR* Name, double Value, double Budget)
+	{
+		if ((Budget > 0.0) && (Value > Budget))
+		{
+			UE_LOG(LogLyra, Error, TEXT("Killcam test: %s is %.2f, budget is at most %.2f"), Name, Value, Budget);
+			++NumFailures;
+		}
+	};
+
+	CheckBudget(TEXT("slowest seek (ms)"), SlowestSeekMs, MaxSeekMs);
+	CheckBudget(TEXT("recording memory (MB)"), PeakRecordMemoryMB, MaxRecordMemoryMB);
+	CheckBudget(TEXT("playback memory (MB)"), PeakPlaybackMemoryMB, MaxPlaybackMemoryMB);
+
+	EndTest((NumFailures > 0) ? 1 : 0);
+}
@@ -0,0 +1,89 @@
+// Copyright Epic Games, Inc.All Rights Reserved.
+
+#pragma once
+
+#include "GauntletTestController.h"
+#include "LyraTestControllerKillcam.generated.h"
+
+class ULyraReplaySubsystem;
+
+/**
+ * ULyraTestControllerKillcam
+ *
+ * Runs a standalone client with bots, records the in-memory killcam for a while, then plays it back beside the live
+ * game and seeks around in it. Reports the seek latency and the memory used by recording and playback, and fails
+ * the test if any of the budgets are exceeded, e.g. -KillcamRecordSeconds=60 -KillcamSeeks=50 -KillcamMaxSeekMs=100
+ */
+UCLASS(Config=Game)
+class ULyraTestControllerKillcam : public UGauntletTestController
+{
+	GENERATED_BODY()
+
+protected:
+	//~UGauntletTestController interface
+	virtual void OnInit() override;
+	virtual void OnTick(float TimeDelta) override;
+	//~End of UGauntletTestController interface
+
+	bool IsExperienceLoaded() const;
+	void StartRecording();
+	void StartPlayback();
+	void TickSeeks();
+	void SampleMemory();
+	void FinishTest();
+
+protected:
+	// Number of bots to spawn in addition to the ones the experience creates (-KillcamBots=)
+	UPROPERTY(Config)
+	int32 NumBots = 8;
+
+	// How long to record the match before playing the killcam back (-KillcamRecordSeconds=)
+	UPROPERTY(Config)
+	float RecordSeconds = 30.0f;
+
+	// Number of seeks to random times in the killcam (-KillcamSeeks=)
+	UPROPERTY(Config)
+	int32 NumSeeks = 20;
+
+	// How long to wait for the experience, the playback or a single seek before failing (-KillcamTimeoutSeconds=)
+	UPROPERTY(Config)
+	float TimeoutSeconds = 120.0f;
+
+	// Budgets, a value of 0 disables the check
+
+	// Slowest seek allowed (-KillcamMaxSeekMs=)
+	UPROPERTY(Config)
+	float MaxSeekMs = 0.0f;
+
+	// Peak physical memory used while recording, above what was used before the recording started (-KillcamMaxRecordMemoryMB=)
+	UPROPERTY(Config)
+	float MaxRecordMemoryMB = 0.0f;
+
+	// Peak physical memory used during playback, above what was used before the recording started (-KillcamMaxPlaybackMemoryMB=)
+	UPROPERTY(Config)
+	float MaxPlaybackMemoryMB = 0.0f;
+
+private:
+	enum class EPhase : uint8
+	{
+		WaitForExperience,
+		Recording,
+		WaitForPlayback,
+		Seeking
+	};
+
+	UPROPERTY(Transient)
+	TObjectPtr<ULyraReplaySubsystem> ReplaySubsystem;
+
+	EPhase Phase = EPhase::WaitForExperience;
+	double PhaseStartTime = 0.0;
+
+	double BaselineMemoryMB = 0.0;
+	double PeakRecordMemoryMB = 0.0;
+	double PeakPlaybackMemoryMB = 0.0;
+
+	TArray<double> SeekDurationsMs;
+	int32 NumFailedSeeks = 0;
+	bool bWaitingForSeek = false;
+	FRandomStream SeekStream;
+};
@@ -0,0 +1,164 @@
+// Copyright Epic Games, Inc.All Rights Reserved.
+
+#include "Tests/LyraTestControllerSoakTest.h"
+#include "Engine/World.h"
+#include "Engine/NetDriver.h"
+#include "Engine/NetworkObjectList.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameModes/LyraGameState.h"
+#include "GameModes/LyraBotCreationComponent.h"
+#include "GameModes/LyraExperienceManagerComponent.h"
+#include "Performance/LyraPerformanceStatSubsystem.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/CommandLine.h"
+#include "LyraLogChannels.h"
+
+void ULyraTestControllerSoakTest::OnInit()
+{
+	Super::OnInit();
+
+	const TCHAR* CommandLine = FCommandLine::Get();
+	FParse::Value(CommandLine, TEXT("SoakBots="), NumBots);
+	FParse::Value(CommandLine, TEXT("SoakMinutes="), SoakMinutes);
+	FParse::Value(CommandLine, TEXT("SoakMaxLoadSeconds="), MaxExperienceLoadSeconds);
+	FParse::Value(CommandLine, TEXT("SoakMaxFrameTimeP95Ms="), MaxFrameTimeP95Ms);
+	FParse::Value(CommandLine, TEXT("SoakMaxFrameTimeP99Ms="), MaxFrameTimeP99Ms);
+	FParse::Value(CommandLine, TEXT("SoakMinServerFPS="), MinServerFPS);
+	FParse::Value(CommandLine, TEXT("SoakMaxMemoryMB="), MaxMemoryMB);
+	FParse::Value(CommandLine, TEXT("SoakMaxAvgBytesPerActor="), MaxAverageBytesPerActor);
+
+	LoadStartTime = FPlatformTime::Seconds();
+
+	UE_LOG(LogLyra, Display, TEXT("Soak test: %d bots for %.1f minutes (budgets: p95 %.1f ms, p99 %.1f ms, min %.1f FPS, %.0f MB, average %.0f bytes/s per actor)"),
+		NumBots, SoakMinutes, MaxFrameTimeP95Ms, MaxFrameTimeP99Ms, MinServerFPS, MaxMemoryMB, MaxAverageBytesPerActor);
+}
+
+void ULyraTestControllerSoakTest::OnTick(float TimeDelta)
+{
+	Super::OnTick(TimeDelta);
+
+	if (!bSoakStarted)
+	{
+		if (!IsExperienceLoaded())
+		{
+			if ((MaxExperienceLoadSeconds > 0.0f) && (FPlatformTime::Seconds() - LoadStartTime > MaxExperienceLoadSeconds))
+			{
+				UE_LOG(LogLyra, Error, TEXT("Soak test: experience did not load within %.1f seconds"), MaxExperienceLoadSeconds);
+				EndTest(1);
+			}
+			return;
+		}
+
+		UWorld* World = GetWorld();
+		UE_LOG(LogLyra, Display, TEXT("Soak test: experience loaded after %.1f seconds, starting soak on %s"), FPlatformTime::Seconds() - LoadStartTime, *GetNameSafe(World));
+
+#if WITH_SERVER_CODE
+		if (ULyraBotCreationComponent* BotComponent = World->GetGameState()->FindComponentByClass<ULyraBotCreationComponent>())
+		{
+			BotComponent->QueueBotSpawns(NumBots);
+		}
+		else
+		{
+			UE_LOG(LogLyra, Warning, TEXT("Soak test: the experience has no bot creation component, running without additional bots"));
+		}
+#endif
+
+		// The stat subsystem has been recording since boot, start the distribution from the match itself
+		StatSubsystem = World->GetGameInstance()->GetSubsystem<ULyraPerformanceStatSubsystem>();
+		if (StatSubsystem)
+		{
+			StatSubsystem->ResetStatHistory();
+		}
+
+		SoakStartTime = FPlatformTime::Seconds();
+		bSoakStarted = true;
+		return;
+	}
+
+	SampleServer(TimeDelta);
+
+	if (FPlatformTime::Seconds() - SoakStartTime >= SoakMinutes * 60.0f)
+	{
+		FinishSoak();
+	}
+}
+
+bool ULyraTestControllerSoakTest::IsExperienceLoaded() const
+{
+	const UWorld* World = GetWorld();
+	const AGameStateBase* GameState = World ? World->GetGameState() : nullptr;
+	const ULyraExperienceManagerComponent* ExperienceComponent = GameState ? GameState->FindComponentByClass<ULyraExperienceManagerComponent>() : nullptr;
+	return ExperienceComponent && ExperienceComponent->IsExperienceLoaded();
+}
+
+void ULyraTestControllerSoakTest::SampleServer(float TimeDelta)
+{
+	UWorld* World = GetWorld();
+	if (World == nullptr)
+	{
+		return;
+	}
+
+	++NumFramesSampled;
+
+	// Ignore the first few seconds, GAverageFPS is still catching up with the map load
+	if (FPlatformTime::Seconds() - SoakStartTime > 5.0)
+	{
+		const ALyraGameState* GameState = World->GetGameState<ALyraGameState>();
+		const double ServerFPS = GameState ? GameState->GetServerFPS() : GAverageFPS;
+		MinSampledServerFPS = (MinSampledServerFPS > 0.0) ? FMath::Min(MinSampledServerFPS, ServerFPS) : ServerFPS;
+	}
+
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+	PeakMemoryMB = FMath::Max(PeakMemoryMB, MemoryStats.UsedPhysical / (1024.0 * 1024.0));
+
+	if (const UNetDriver* NetDriver = World->GetNetDriver())
+	{
+		const int32 NumReplicatedActors = NetDriver->GetNetworkObjectList().GetAllObjects().Num();
+		if (NumReplicatedActors > 0)
+		{
+			// The net driver only tracks its total outgoing rate, spread it evenly over the replicated actors
+			OutBytesPerSecondSum += NetDriver->OutBytesPerSecond;
+			AverageBytesPerActorSum += NetDriver->OutBytesPerSecond / (double)NumReplicatedActors;
+			++NumReplicationSamples;
+		}
+	}
+}
+
+void ULyraTestControllerSoakTest::FinishSoak()
+{
+	const double FrameTimeP50Ms = StatSubsystem ? StatSubsystem->GetStatPercentile(ELyraDisplayablePerformanceStat::FrameTime, 50.0) * 1000.0 : 0.0;
+	const double FrameTimeP95Ms = StatSubsystem ? StatSubsystem->GetStatPercentile(ELyraDisplayablePerformanceStat::FrameTime, 95.0) * 1000.0 : 0.0;
+	const double FrameTimeP99Ms = StatSubsystem ? StatSubsystem->GetStatPercentile(ELyraDisplayablePerformanceStat::FrameTime, 99.0) * 1000.0 : 0.0;
+	const double OutBytesPerSecond = (NumReplicationSamples > 0) ? (OutBytesPerSecondSum / NumReplicationSamples) : 0.0;
+	const double AverageBytesPerActor = (NumReplicationSamples > 0) ? (AverageBytesPerActorSum / NumReplicationSamples) : 0.0;
+
+	UE_LOG(LogLyra, Display, TEXT("Soak test results over %lld frames:"), NumFramesSampled);
+	UE_LOG(LogLyra, Display, TEXT("    Frame time: p50 %.2f ms, p95 %.2f ms, p99 %.2f ms"), FrameTimeP50Ms, FrameTimeP95Ms, FrameTimeP99Ms);
+	UE_LOG(LogLyra, Display, TEXT("    Lowest server FPS: %.1f"), MinSampledServerFPS);
+	UE_LOG(LogLyra, Display, TEXT("    Peak memory: %.1f MB"), PeakMemoryMB);
+	UE_LOG(LogLyra, Display, TEXT("    Replication: %.1f bytes/s out, average %.1f bytes/s per replicated actor"), OutBytesPerSecond, AverageBytesPerActor);
+
+	if (StatSubsystem)
+	{
+		UE_LOG(LogLyra, Display, TEXT("    Stats written to %s"), *StatSubsystem->DumpStatsToCSV(TEXT("SoakTest")));
+	}
+
+	int32 NumFailures = 0;
+	auto CheckBudget = [&NumFailures](const TCHAR* Name, double Value, double Budget, bool bIsMinimum)
+	{
+		if ((Budget > 0.0) && (bIsMinimum ? (Value < Budget) : (Value > Budget)))
+		{
+			UE_LOG(LogLyra, Error, TEXT("Soak test: %s is %.2f, budget is %s %.2f"), Name, Value, bIsMinimum ? TEXT("at least") : TEXT("at most"), Budget);
+			++NumFailures;
+		}
+	};
+
+	CheckBudget(TEXT("p95 frame time (ms)"), FrameTimeP95Ms, MaxFrameTimeP95Ms, false);
+	CheckBudget(TEXT("p99 frame time (ms)"), FrameTimeP99Ms, MaxFrameTimeP99Ms, false);
+	CheckBudget(TEXT("lowest server FPS"), MinSampledServerFPS, MinServerFPS, true);
+	CheckBudget(TEXT("peak memory (MB)"), PeakMemoryMB, MaxMemoryMB, false);
+	CheckBudget(TEXT("average bytes/s per replicated actor"), AverageBytesPerActor, MaxAverageBytesPerActor, false);
+
+	EndTest((NumFailures > 0) ? 1 : 0);
+}
@@ -0,0 +1,83 @@
+// Copyright Epic Games, Inc.All Rights Reserved.
+
+#pragma once
+
+#include "GauntletTestController.h"
+#include "LyraTestControllerSoakTest.generated.h"
+
+class ULyraPerformanceStatSubsystem;
+
+/**
+ * ULyraTestControllerSoakTest
+ *
+ * Runs on a dedicated server with bots for a fixed amount of time, samples server performance and
+ * fails the test if any of the budgets are exceeded. All settings can be overridden on the command line,
+ * e.g. -SoakMinutes=10 -SoakMaxFrameTimeP99Ms=40
+ */
+UCLASS(Config=Game)
+class ULyraTestControllerSoakTest : public UGauntletTestController
+{
+	GENERATED_BODY()
+
+protected:
+	//~UGauntletTestController interface
+	virtual void OnInit() override;
+	virtual void OnTick(float TimeDelta) override;
+	//~End of UGauntletTestController interface
+
+	bool IsExperienceLoaded() const;
+	void SampleServer(float TimeDelta);
+	void FinishSoak();
+
+protected:
+	// Number of bots to spawn in addition to the ones the experience creates (-SoakBots=)
+	UPROPERTY(Config)
+	int32 NumBots = 16;
+
+	// How long to run the match for once the experience has loaded (-SoakMinutes=)
+	UPROPERTY(Config)
+	float SoakMinutes = 5.0f;
+
+	// How long to wait for the experience to load before failing (-SoakMaxLoadSeconds=)
+	UPROPERTY(Config)
+	float MaxExperienceLoadSeconds = 120.0f;
+
+	// Budgets, a value of 0 disables the check
+
+	// 95th percentile server frame time (-SoakMaxFrameTimeP95Ms=)
+	UPROPERTY(Config)
+	float MaxFrameTimeP95Ms = 40.0f;
+
+	// 99th percentile server frame time (-SoakMaxFrameTimeP99Ms=)
+	UPROPERTY(Config)
+	float MaxFrameTimeP99Ms = 66.0f;
+
+	// Lowest average server FPS allowed (-SoakMinServerFPS=)
+	UPROPERTY(Config)
+	float MinServerFPS = 25.0f;
+
+	// Peak physical memory used by the server (-SoakMaxMemoryMB=)
+	UPROPERTY(Config)
+	float MaxMemoryMB = 0.0f;
+
+	// Average outgoing bytes per second per replicated actor (-SoakMaxAvgBytesPerActor=). This is the net driver's total
+	// outgoing rate divided by the number of replicated actors, so it tracks overall bandwidth growth and cannot single out
+	// a class, use a Networking Insights trace for that
+	UPROPERTY(Config)
+	float MaxAverageBytesPerActor = 0.0f;
+
+private:
+	UPROPERTY(Transient)
+	TObjectPtr<ULyraPerformanceStatSubsystem> StatSubsystem;
+
+	double LoadStartTime = 0.0;
+	double SoakStartTime = 0.0;
+	bool bSoakStarted = false;
+
+	int64 NumFramesSampled = 0;
+	double MinSampledServerFPS = 0.0;
+	double PeakMemoryMB = 0.0;
+	double OutBytesPerSecondSum = 0.0;
+	double AverageBytesPerActorSum = 0.0;
+	int64 NumReplicationSamples = 0;
+};
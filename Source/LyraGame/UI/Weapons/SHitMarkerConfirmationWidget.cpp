@@ -29,20 +29,15 @@ int32 SHitMarkerConfirmationWidget::OnPaint(const FPaintArgs& Args, const FGeome
 	if (bDrawMarkers)
 	{
 		// Check if we should use screen-space damage location hit notifies
-		TArray<FLyraScreenSpaceHitLocation> LastWeaponDamageScreenLocations;
+		const ULyraWeaponStateComponent* WeaponStateComponent = nullptr;
 		if (APlayerController* PC = MyContext.IsInitialized() ? MyContext.GetPlayerController() : nullptr)
 		{
-			if (ULyraWeaponStateComponent* WeaponStateComponent = PC->FindComponentByClass<ULyraWeaponStateComponent>())
-			{
-				WeaponStateComponent->GetLastWeaponDamageScreenLocations(/*out*/ LastWeaponDamageScreenLocations);
-			}
+			WeaponStateComponent = PC->FindComponentByClass<ULyraWeaponStateComponent>();
 		}
 
-		if ((LastWeaponDamageScreenLocations.Num() > 0) && (PerHitMarkerImage != nullptr))
+		if ((WeaponStateComponent != nullptr) && (WeaponStateComponent->GetLastWeaponDamageScreenLocations().Num() > 0) && (PerHitMarkerImage != nullptr))
 		{
-			const FVector2D HalfAbsoluteSize = AllottedGeometry.GetAbsoluteSize() * 0.5f;
-
-			for (const FLyraScreenSpaceHitLocation& Hit : LastWeaponDamageScreenLocations)
+			for (const FLyraScreenSpaceHitLocation& Hit : WeaponStateComponent->GetLastWeaponDamageScreenLocations())
 			{
 				const FSlateBrush* LocationMarkerImage = PerHitMarkerZoneOverrideImages.Find(Hit.HitZone);
 				if (LocationMarkerImage == nullptr)
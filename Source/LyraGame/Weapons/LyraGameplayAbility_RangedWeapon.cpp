@@ -573,7 +573,7 @@ void ULyraGameplayAbility_RangedWeapon::StartRangedWeaponTargeting()
 
 	// Fill out the target data from the hit results
 	FGameplayAbilityTargetDataHandle TargetData;
-	TargetData.UniqueId = WeaponStateComponent ? WeaponStateComponent->GetUnconfirmedServerSideHitMarkerCount() : 0;
+	TargetData.UniqueId = WeaponStateComponent ? WeaponStateComponent->AllocateHitMarkerBatchId() : 0;
 
 	if (FoundHits.Num() > 0)
 	{
@@ -23,6 +23,9 @@ ULyraWeaponStateComponent::ULyraWeaponStateComponent(const FObjectInitializer& O
 
 	PrimaryComponentTick.bStartWithTickEnabled = true;
 	PrimaryComponentTick.bCanEverTick = true;
+
+	// Only a handful of shots are ever in flight, so the map shouldn't need to grow during play
+	UnconfirmedServerSideHitMarkers.Reserve(16);
 }
 
 void ULyraWeaponStateComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -65,44 +68,39 @@ bool ULyraWeaponStateComponent::ShouldUpdateDamageInstigatedTime(const FGameplay
 
 void ULyraWeaponStateComponent::ClientConfirmTargetData_Implementation(uint16 UniqueId, bool bSuccess, const TArray<uint8>& HitReplaces)
 {
-	for (int i = 0; i < UnconfirmedServerSideHitMarkers.Num(); i++)
+	const uint8 BatchId = (uint8)UniqueId;
+	if (FLyraServerSideHitMarkerBatch* Batch = UnconfirmedServerSideHitMarkers.Find(BatchId))
 	{
-		FLyraServerSideHitMarkerBatch& Batch = UnconfirmedServerSideHitMarkers[i];
-		if (Batch.UniqueId == UniqueId)
+		if (bSuccess && (HitReplaces.Num() != Batch->Markers.Num()))
 		{
-			if (bSuccess && (HitReplaces.Num() != Batch.Markers.Num()))
-			{
-				UWorld* World = GetWorld();
-				bool bFoundShowAsSuccessHit = false;
+			bool bFoundShowAsSuccessHit = false;
 
-				int32 HitLocationIndex = 0;
-				for (const FLyraScreenSpaceHitLocation& Entry : Batch.Markers)
+			int32 HitLocationIndex = 0;
+			for (const FLyraScreenSpaceHitLocation& Entry : Batch->Markers)
+			{
+				if (!HitReplaces.Contains(HitLocationIndex) && Entry.bShowAsSuccess)
 				{
-					if (!HitReplaces.Contains(HitLocationIndex) && Entry.bShowAsSuccess)
+					// Only need to do this once
+					if (!bFoundShowAsSuccessHit)
 					{
-						// Only need to do this once
-						if (!bFoundShowAsSuccessHit)
-						{
-							ActuallyUpdateDamageInstigatedTime();
-						}
+						ActuallyUpdateDamageInstigatedTime();
+					}
 
-						bFoundShowAsSuccessHit = true;
+					bFoundShowAsSuccessHit = true;
 
-						LastWeaponDamageScreenLocations.Add(Entry);
-					}
-					++HitLocationIndex;
+					LastWeaponDamageScreenLocations.Add(Entry);
 				}
+				++HitLocationIndex;
 			}
-
-			UnconfirmedServerSideHitMarkers.RemoveAt(i);
-			break;
 		}
+
+		UnconfirmedServerSideHitMarkers.Remove(BatchId);
 	}
 }
 
 void ULyraWeaponStateComponent::AddUnconfirmedServerSideHitMarkers(const FGameplayAbilityTargetDataHandle& InTargetData, const TArray<FHitResult>& FoundHits)
 {
-	FLyraServerSideHitMarkerBatch& NewUnconfirmedHitMarker = UnconfirmedServerSideHitMarkers.Emplace_GetRef(InTargetData.UniqueId);
+	FLyraServerSideHitMarkerBatch& NewUnconfirmedHitMarker = UnconfirmedServerSideHitMarkers.Add(InTargetData.UniqueId, FLyraServerSideHitMarkerBatch(InTargetData.UniqueId));
 
 	if (APlayerController* OwnerPC = GetController<APlayerController>())
 	{
@@ -133,6 +131,21 @@ void ULyraWeaponStateComponent::AddUnconfirmedServerSideHitMarkers(const FGamepl
 	}
 }
 
+uint8 ULyraWeaponStateComponent::AllocateHitMarkerBatchId()
+{
+	// Skip over any IDs still waiting on confirmation (there can never be more than 256 of them in flight)
+	for (int32 Attempt = 0; Attempt < 256; ++Attempt)
+	{
+		const uint8 CandidateId = NextHitMarkerBatchId++;
+		if (!UnconfirmedServerSideHitMarkers.Contains(CandidateId))
+		{
+			return CandidateId;
+		}
+	}
+
+	return NextHitMarkerBatchId++;
+}
+
 void ULyraWeaponStateComponent::UpdateDamageInstigatedTime(const FGameplayEffectContextHandle& EffectContext)
 {
 	if (ShouldUpdateDamageInstigatedTime(EffectContext))
@@ -22,6 +22,64 @@ struct FLyraScreenSpaceHitLocation
 	bool bShowAsSuccess = false;
 };
 
+// Fixed-capacity ring of the most recent confirmed hit markers, once full the oldest entries are overwritten
+// Nothing is allocated after construction, and it can be iterated (oldest first) through a const reference
+class FLyraScreenSpaceHitLocationRing
+{
+public:
+	static constexpr int32 Capacity = 32;
+
+	void Add(const FLyraScreenSpaceHitLocation& Hit)
+	{
+		Entries[(Head + Count) % Capacity] = Hit;
+		if (Count < Capacity)
+		{
+			++Count;
+		}
+		else
+		{
+			Head = (Head + 1) % Capacity;
+		}
+	}
+
+	void Reset()
+	{
+		Head = 0;
+		Count = 0;
+	}
+
+	int32 Num() const { return Count; }
+
+	/** Index 0 is the oldest entry */
+	const FLyraScreenSpaceHitLocation& operator[](int32 Index) const
+	{
+		check((Index >= 0) && (Index < Count));
+		return Entries[(Head + Index) % Capacity];
+	}
+
+	class FConstIterator
+	{
+	public:
+		FConstIterator(const FLyraScreenSpaceHitLocationRing& InRing, int32 InIndex) : Ring(InRing), Index(InIndex) { }
+
+		const FLyraScreenSpaceHitLocation& operator*() const { return Ring[Index]; }
+		FConstIterator& operator++() { ++Index; return *this; }
+		bool operator!=(const FConstIterator& Other) const { return Index != Other.Index; }
+
+	private:
+		const FLyraScreenSpaceHitLocationRing& Ring;
+		int32 Index;
+	};
+
+	FConstIterator begin() const { return FConstIterator(*this, 0); }
+	FConstIterator end() const { return FConstIterator(*this, Count); }
+
+private:
+	FLyraScreenSpaceHitLocation Entries[Capacity];
+	int32 Head = 0;
+	int32 Count = 0;
+};
+
 struct FLyraServerSideHitMarkerBatch
 {
 	FLyraServerSideHitMarkerBatch() { }
@@ -30,7 +88,8 @@ struct FLyraServerSideHitMarkerBatch
 		UniqueId(InUniqueId)
 	{ }
 
-	TArray<FLyraScreenSpaceHitLocation> Markers;
+	// Inline so a typical shot (including a shotgun blast) doesn't allocate
+	TArray<FLyraScreenSpaceHitLocation, TInlineAllocator<16>> Markers;
 
 	uint8 UniqueId = 0;
 };
@@ -55,10 +114,10 @@ public:
 	/** Updates this player's last damage instigated time */
 	void UpdateDamageInstigatedTime(const FGameplayEffectContextHandle& EffectContext);
 
-	/** Gets the array of most recent locations this player instigated damage, in screen-space */
-	void GetLastWeaponDamageScreenLocations(TArray<FLyraScreenSpaceHitLocation>& WeaponDamageScreenLocations)
+	/** Gets the most recent locations this player instigated damage, in screen-space */
+	const FLyraScreenSpaceHitLocationRing& GetLastWeaponDamageScreenLocations() const
 	{
-		WeaponDamageScreenLocations = LastWeaponDamageScreenLocations;
+		return LastWeaponDamageScreenLocations;
 	}
 
 	/** Returns the elapsed time since the last (outgoing) damage hit notification occurred */
@@ -69,6 +128,9 @@ public:
 		return UnconfirmedServerSideHitMarkers.Num();
 	}
 
+	/** Returns a batch ID that isn't used by any of the unconfirmed hit marker batches */
+	uint8 AllocateHitMarkerBatchId();
+
 protected:
 	// This is called to filter hit results to determine whether they should be considered as a successful hit or not
 	// The default behavior is to treat it as a success if being done to a team actor that belongs to a different team
@@ -84,8 +146,15 @@ private:
 	double LastWeaponDamageInstigatedTime = 0.0;
 
 	/** Screen-space locations of our most recently instigated weapon damage (the confirmed hits) */
-	TArray<FLyraScreenSpaceHitLocation> LastWeaponDamageScreenLocations;
+	FLyraScreenSpaceHitLocationRing LastWeaponDamageScreenLocations;
+
+	/** The unconfirmed hits, by batch ID */
+	TMap<uint8, FLyraServerSideHitMarkerBatch> UnconfirmedServerSideHitMarkers;
+
+	/** The next batch ID to hand out */
+	uint8 NextHitMarkerBatchId = 0;
 
-	/** The unconfirmed hits */
-	TArray<FLyraServerSideHitMarkerBatch> UnconfirmedServerSideHitMarkers;
+#if WITH_DEV_AUTOMATION_TESTS
+	friend class FLyraHitMarkerConfirmationTest;
+#endif
 };